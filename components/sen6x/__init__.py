@@ -2,42 +2,326 @@
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome import automation
 from esphome.components import i2c, sensor
-from esphome.const import CONF_ID
+from esphome.const import (
+    CONF_DURATION,
+    CONF_ID,
+    CONF_INTERVAL,
+    CONF_MODE,
+    CONF_MODEL,
+    CONF_PERIOD,
+    CONF_PRIORITY,
+    CONF_UPDATE_INTERVAL,
+)
+from esphome.core import CORE
 
 DEPENDENCIES = ["i2c"]
-AUTO_LOAD = ["sensor", "button", "number", "text_sensor", "binary_sensor", "switch"]
+# Entity platforms are loaded by their own YAML blocks; each emits a
+# USE_SEN6X_* define so unused subsystems are compiled out
+AUTO_LOAD = ["sensor"]
+MULTI_CONF = True
 
 sen6x_ns = cg.esphome_ns.namespace("sen6x")
 Sen6xComponent = sen6x_ns.class_(
     "Sen6xComponent", cg.PollingComponent, i2c.I2CDevice
 )
+Sen6xBusScheduler = sen6x_ns.class_("Sen6xBusScheduler", cg.Component)
 Sen6xModel = sen6x_ns.enum("Sen6xModel")
 RhtAcceleration = sen6x_ns.struct("RhtAcceleration")
+Sen6xPollingMode = sen6x_ns.enum("Sen6xPollingMode", is_class=True)
+Sen6xChannel = sen6x_ns.enum("Sen6xChannel", is_class=True)
+Sen6xAggregate = sen6x_ns.enum("Sen6xAggregate", is_class=True)
+Sen6xPressureFilterMode = sen6x_ns.enum("Sen6xPressureFilterMode", is_class=True)
+Sen6xWarmUpGroup = sen6x_ns.enum("Sen6xWarmUpGroup", is_class=True)
+Sen6xDiagnosticSensor = sen6x_ns.enum("Sen6xDiagnosticSensor", is_class=True)
+StartBurstAction = sen6x_ns.class_("StartBurstAction", automation.Action)
+StopBurstAction = sen6x_ns.class_("StopBurstAction", automation.Action)
+ForcedCo2CalibrationAction = sen6x_ns.class_(
+    "ForcedCo2CalibrationAction", automation.Action
+)
 
 CONF_SEN6X_ID = "sen6x_id"
 CONF_PRESSURE_SOURCE = "pressure_source"
+CONF_PRESSURE_FILTER = "pressure_filter"
+CONF_ALPHA = "alpha"
+CONF_WINDOW = "window"
+CONF_HYSTERESIS = "hysteresis"
 CONF_RHT_ACCELERATION = "rht_acceleration"
 CONF_RHT_K = "k"
 CONF_RHT_P = "p"
 CONF_RHT_T1 = "t1"
 CONF_RHT_T2 = "t2"
+CONF_CONFIGURATION_DEBOUNCE = "configuration_debounce"
+CONF_CRC_TABLE = "crc_table"
+CONF_POLLING_MODE = "polling_mode"
+CONF_BUS_TIME_BUDGET = "bus_time_budget"
+CONF_PUBLISH_ON_CHANGE_ONLY = "publish_on_change_only"
+CONF_DECIMATION = "decimation"
+CONF_AGGREGATION_INTERVAL = "aggregation_interval"
+CONF_DIAGNOSTICS_INTERVAL = "diagnostics_interval"
+CONF_STATUS = "status"
+CONF_FRAME = "frame"
+CONF_NUMBER_CONCENTRATION = "number_concentration"
+CONF_READBACK = "readback"
+CONF_VOC_BASELINE = "voc_baseline"
+CONF_STORE = "store"
+CONF_MIN_INTERVAL = "min_interval"
+CONF_MAX_DIFF = "max_diff"
+CONF_CAPTURE = "capture"
+CONF_BUFFER_SIZE = "buffer_size"
+CONF_BURST = "burst"
+CONF_PM_2_5_STEP = "pm_2_5_step"
+CONF_CO2_STEP = "co2_step"
+CONF_VOC_INDEX_STEP = "voc_index_step"
+CONF_SENSOR_TASK = "sensor_task"
+CONF_DUTY_CYCLE = "duty_cycle"
+CONF_WARM_UP = "warm_up"
+CONF_CORE = "core"
+CONF_STACK_SIZE = "stack_size"
+CONF_CIRCUIT_BREAKER = "circuit_breaker"
+CONF_FAILURE_THRESHOLD = "failure_threshold"
+CONF_BACKOFF = "backoff"
+CONF_MAX_BACKOFF = "max_backoff"
+CONF_SHT_HEATER = "sht_heater"
+CONF_MIN_HUMIDITY = "min_humidity"
+CONF_CO2_CALIBRATION_GATE = "co2_calibration_gate"
+CONF_SAMPLES = "samples"
+CONF_MAX_SPREAD = "max_spread"
+CONF_MAX_DEVIATION = "max_deviation"
+CONF_REFERENCE = "reference"
+CONF_BUS_SCHEDULER_ID = "bus_scheduler_id"
+KEY_BUS_SCHEDULER_REGISTERED = "sen6x_bus_scheduler_registered"
 
-# SEN6x Model Definitions (per Sensirion Datasheet v0.91+)
-# Model capabilities: PM, PM4.0, RH/T, VOC, NOx, CO2, HCHO
-MODEL_CAPABILITIES = {
+Sen6xPollGroup = sen6x_ns.enum("Sen6xPollGroup", is_class=True)
+
+# Per-group polling divider (in update cycles)
+DECIMATION_SCHEMA = cv.Schema({
+    # Measured values frame (PM, RH/T, VOC/NOx, CO2, HCHO)
+    cv.Optional(CONF_FRAME, default=1): cv.int_range(min=1, max=255),
+    # Number concentration (separate 0x0316 read)
+    cv.Optional(CONF_NUMBER_CONCENTRATION, default=1): cv.int_range(min=1, max=255),
+    # Device Status: every N cycles, every cycle while a flag is latched
+    cv.Optional(CONF_STATUS, default=1): cv.int_range(min=1, max=255),
+    # Ambient pressure / altitude readback (0 = at boot only)
+    cv.Optional(CONF_READBACK, default=0): cv.int_range(min=0, max=255),
+})
+
+# VOC algorithm state persistence (same policy as the SEN5x component)
+VOC_BASELINE_SCHEMA = cv.Schema({
+    cv.Optional(CONF_STORE, default=True): cv.boolean,
+    # Minimum time between two stores (bounds flash writes per day)
+    cv.Optional(CONF_MIN_INTERVAL, default="3h"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(minutes=10)),
+    ),
+    # Store only when a state word moved by more than this
+    cv.Optional(CONF_MAX_DIFF, default=50): cv.int_range(min=0, max=65535),
+})
+
+# Raw response capture ring (dumped over the log, replayed on the host)
+CAPTURE_SCHEMA = cv.Schema({
+    # Bytes of RAM; a SEN66 cycle (frame + NC + status) takes ~44 bytes
+    cv.Optional(CONF_BUFFER_SIZE, default=2048): cv.int_range(min=64, max=32768),
+})
+
+# Event-triggered burst sampling: a step between two consecutive samples
+# switches polling to 'interval' for 'duration' (extended by every trigger)
+BURST_TRIGGERS = {
+    CONF_PM_2_5_STEP: Sen6xChannel.PM_2_5,  # µg/m³
+    CONF_CO2_STEP: Sen6xChannel.CO2,  # ppm
+    CONF_VOC_INDEX_STEP: Sen6xChannel.VOC_INDEX,  # index points
+}
+
+BURST_SCHEMA = cv.Schema({
+    cv.Optional(CONF_INTERVAL, default="1s"): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(seconds=1)),
+    ),
+    cv.Optional(CONF_DURATION, default="5min"): cv.positive_time_period_milliseconds,
+    **{cv.Optional(key): cv.positive_float for key in BURST_TRIGGERS},
+})
+
+# External pressure pipeline: every pressure_source reading is filtered; the
+# sensor is written at most every min_interval, once the filtered value moved
+# by at least hysteresis since the last write
+PRESSURE_FILTER_MODES = {
+    "NONE": Sen6xPressureFilterMode.NONE,
+    "EMA": Sen6xPressureFilterMode.EMA,
+    "MEDIAN": Sen6xPressureFilterMode.MEDIAN,
+}
+
+PRESSURE_FILTER_SCHEMA = cv.Schema({
+    cv.Optional(CONF_MODE, default="EMA"): cv.enum(
+        PRESSURE_FILTER_MODES, upper=True
+    ),
+    # EMA weight of the newest reading
+    cv.Optional(CONF_ALPHA, default=0.2): cv.float_range(
+        min=0.01, max=1.0
+    ),
+    # MEDIAN window (readings)
+    cv.Optional(CONF_WINDOW, default=5): cv.int_range(min=1, max=9),
+    cv.Optional(
+        CONF_MIN_INTERVAL, default="60s"
+    ): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_HYSTERESIS, default=1.0): cv.float_range(
+        min=0.0, max=50.0
+    ),  # hPa
+})
+
+# Duty-cycled measurement: stopped between samples, restarted every 'period'.
+# A channel is published once its group's warm-up has passed after a start.
+WARM_UP_GROUPS = {
+    "pm": (Sen6xWarmUpGroup.PM, "30s"),  # Also Number Concentration
+    "humidity_temperature": (Sen6xWarmUpGroup.RHT, "10s"),
+    "voc_nox": (Sen6xWarmUpGroup.GAS, "60s"),
+    "co2": (Sen6xWarmUpGroup.CO2, "30s"),
+    "formaldehyde": (Sen6xWarmUpGroup.FORMALDEHYDE, "60s"),
+}
+
+
+def validate_duty_cycle(config):
+    # Stop (1.4 s) + the longest warm-up must fit in one period
+    longest = max(t.total_milliseconds for t in config[CONF_WARM_UP].values())
+    if config[CONF_PERIOD].total_milliseconds < longest + 5000:
+        raise cv.Invalid(
+            f"'{CONF_PERIOD}' must be at least 5s longer than the longest warm-up"
+        )
+    return config
+
+
+# SEN63C/SEN69C: the CO2 sensor needs >= 24s between two measurement starts
+# and the duty cycle starts once per period. Without a pinned model the
+# sensor may turn out to be one of them.
+CO2_RESTART_GAP_MODELS = ("SEN63C", "SEN69C")
+CO2_RESTART_GAP_MS = 24000
+
+
+def validate_duty_cycle_model(config):
+    if CONF_DUTY_CYCLE not in config:
+        return config
+    model = config.get(CONF_MODEL)
+    if model is not None and model not in CO2_RESTART_GAP_MODELS:
+        return config
+    if config[CONF_DUTY_CYCLE][CONF_PERIOD].total_milliseconds < CO2_RESTART_GAP_MS:
+        raise cv.Invalid(
+            f"'{CONF_DUTY_CYCLE}' '{CONF_PERIOD}' must be at least 24s on "
+            f"SEN63C/SEN69C (pin '{CONF_MODEL}' to allow shorter periods on "
+            "other models)",
+            path=[CONF_DUTY_CYCLE, CONF_PERIOD],
+        )
+    return config
+
+
+DUTY_CYCLE_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Required(CONF_PERIOD): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_WARM_UP, default={}): cv.Schema({
+            cv.Optional(key, default=default): cv.positive_time_period_milliseconds
+            for key, (_, default) in WARM_UP_GROUPS.items()
+        }),
+    }),
+    validate_duty_cycle,
+)
+
+# Dedicated FreeRTOS task for the measurement cycle's I2C reads (ESP32)
+SENSOR_TASK_SCHEMA = cv.Schema({
+    # Default core 0: the ESPHome loop runs on core 1 of dual-core chips, so
+    # the task's blocking reads don't compete with it. Clamped to 0 on
+    # single-core chips.
+    cv.Optional(CONF_CORE, default=0): cv.int_range(min=0, max=1),
+    cv.Optional(CONF_PRIORITY, default=5): cv.int_range(min=1, max=24),
+    cv.Optional(CONF_STACK_SIZE, default=4096): cv.int_range(min=2048, max=16384),
+})
+
+# Bus-fault circuit breaker: after failure_threshold consecutive failed
+# transactions the bus is left alone; a probe every backoff (doubling up to
+# max_backoff) re-initializes measurement once the sensor answers again
+def validate_circuit_breaker(config):
+    if config[CONF_MAX_BACKOFF] < config[CONF_BACKOFF]:
+        raise cv.Invalid(
+            f"'{CONF_MAX_BACKOFF}' must not be shorter than '{CONF_BACKOFF}'"
+        )
+    return config
+
+
+CIRCUIT_BREAKER_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_FAILURE_THRESHOLD, default=5): cv.int_range(
+            min=1, max=50
+        ),
+        cv.Optional(CONF_BACKOFF, default="5s"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(seconds=1)),
+        ),
+        cv.Optional(CONF_MAX_BACKOFF, default="5min"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(max=cv.TimePeriod(hours=1)),
+        ),
+    }),
+    validate_circuit_breaker,
+)
+
+# Periodic SHT heater cycles (condensation, creep at high humidity); with
+# min_humidity a cycle only runs while RH is at or above it
+SHT_HEATER_SCHEMA = cv.Schema({
+    cv.Required(CONF_INTERVAL): cv.All(
+        cv.positive_time_period_milliseconds,
+        cv.Range(min=cv.TimePeriod(minutes=10), max=cv.TimePeriod(days=49)),
+    ),
+    cv.Optional(CONF_MIN_HUMIDITY): cv.percentage,
+})
+
+# Forced CO2 recalibration only once the last 'samples' CO2 readings lie
+# within max_spread ppm (and their mean within max_deviation of the reference)
+CO2_CALIBRATION_GATE_SCHEMA = cv.Schema({
+    cv.Optional(CONF_SAMPLES, default=10): cv.int_range(min=2, max=30),
+    cv.Optional(CONF_MAX_SPREAD, default=30): cv.int_range(min=0, max=1000),
+    cv.Optional(CONF_MAX_DEVIATION): cv.int_range(min=0, max=5000),
+})
+
+# CRC-8 lookup table size: FULL (256 bytes, fastest) or NIBBLE (16 bytes)
+CRC_TABLES = ["FULL", "NIBBLE"]
+
+# Measurement scheduling: probe data-ready every update, or phase-lock reads
+# to the sensor's 1s measurement cadence
+POLLING_MODES = {
+    "INTERVAL": Sen6xPollingMode.INTERVAL,
+    "PHASE_LOCKED": Sen6xPollingMode.PHASE_LOCKED,
+}
+
+# SEN6x Model Definitions (per Sensirion Datasheet v0.92 Table 26)
+# Channels of each model's measured-values frame, in word order. Mirrors
+# Sen6xModelTraits<M>::FIELDS in sen6x.h; capabilities are derived from it.
+COMMON_FRAME_CHANNELS = ("pm_1_0", "pm_2_5", "pm_4_0", "pm_10_0", "humidity", "temperature")
+MODEL_FRAME_CHANNELS = {
     # SEN62: PM + RH/T (basic environmental)
-    "SEN62": {"pm": True, "pm4": True, "rht": True, "voc": False, "nox": False, "co2": False, "hcho": False},
+    "SEN62": COMMON_FRAME_CHANNELS,
     # SEN63C: PM + RH/T + CO2 (CO2 variant)
-    "SEN63C": {"pm": True, "pm4": False, "rht": True, "voc": False, "nox": False, "co2": True, "hcho": False},
+    "SEN63C": COMMON_FRAME_CHANNELS + ("co2",),
     # SEN65: PM + RH/T + VOC + NOx (VOC/NOx variant)
-    "SEN65": {"pm": True, "pm4": False, "rht": True, "voc": True, "nox": True, "co2": False, "hcho": False},
+    "SEN65": COMMON_FRAME_CHANNELS + ("voc_index", "nox_index"),
     # SEN66: PM + RH/T + VOC + NOx + CO2 (full-featured AIQ)
-    "SEN66": {"pm": True, "pm4": True, "rht": True, "voc": True, "nox": True, "co2": True, "hcho": False},
+    "SEN66": COMMON_FRAME_CHANNELS + ("voc_index", "nox_index", "co2"),
     # SEN68: PM + RH/T + VOC + NOx + HCHO (formaldehyde variant)
-    "SEN68": {"pm": True, "pm4": False, "rht": True, "voc": True, "nox": True, "co2": False, "hcho": True},
-    # SEN69C: PM + RH/T + VOC + NOx + CO2 + HCHO (ultimate variant)
-    "SEN69C": {"pm": True, "pm4": True, "rht": True, "voc": True, "nox": True, "co2": True, "hcho": True},
+    "SEN68": COMMON_FRAME_CHANNELS + ("voc_index", "nox_index", "formaldehyde"),
+    # SEN69C: PM + RH/T + VOC + NOx + HCHO + CO2 (ultimate variant)
+    "SEN69C": COMMON_FRAME_CHANNELS
+    + ("voc_index", "nox_index", "formaldehyde", "co2"),
+}
+
+# Model capabilities: PM, PM4.0, RH/T, VOC, NOx, CO2, HCHO
+MODEL_CAPABILITIES = {
+    model: {
+        "pm": "pm_2_5" in channels,
+        "pm4": "pm_4_0" in channels,
+        "rht": "humidity" in channels,
+        "voc": "voc_index" in channels,
+        "nox": "nox_index" in channels,
+        "co2": "co2" in channels,
+        "hcho": "formaldehyde" in channels,
+    }
+    for model, channels in MODEL_FRAME_CHANNELS.items()
 }
 
 # Map model names to C++ enum values (Sen6xModel::VALUE)
@@ -60,22 +344,84 @@ RHT_ACCELERATION_SCHEMA = cv.Schema({
     cv.Required(CONF_RHT_T2): cv.int_range(min=0, max=65535),
 })
 
-CONFIG_SCHEMA = (
-    cv.Schema(
-        {
-            cv.GenerateID(): cv.declare_id(Sen6xComponent),
-            # Optional external pressure sensor for CO2 compensation
-            # Accepts the ID of any ESPHome sensor (BME280, BMP280, etc.)
-            cv.Optional(CONF_PRESSURE_SOURCE): cv.use_id(sensor.Sensor),
-            # RHT Acceleration parameters (YAML-only, volatile)
-            cv.Optional(CONF_RHT_ACCELERATION): RHT_ACCELERATION_SCHEMA,
-        }
-    )
-    .extend(cv.polling_component_schema("10s"))
-    .extend(i2c.i2c_device_schema(0x6B))
+CONFIG_SCHEMA = cv.All(
+    (
+        cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(Sen6xComponent),
+                # Shared bus scheduler (only the first instance registers it)
+                cv.GenerateID(CONF_BUS_SCHEDULER_ID): cv.declare_id(
+                    Sen6xBusScheduler
+                ),
+                # Optional: pin the model for a compile-time specialized decoder
+                # (auto-detected from the product name when omitted)
+                cv.Optional(CONF_MODEL): cv.one_of(*MODELS, upper=True),
+                # Optional external pressure sensor for CO2 compensation
+                # Accepts the ID of any ESPHome sensor (BME280, BMP280, etc.)
+                cv.Optional(CONF_PRESSURE_SOURCE): cv.use_id(sensor.Sensor),
+                cv.Optional(
+                    CONF_PRESSURE_FILTER, default={}
+                ): PRESSURE_FILTER_SCHEMA,
+                # RHT Acceleration parameters (YAML-only, volatile)
+                cv.Optional(CONF_RHT_ACCELERATION): RHT_ACCELERATION_SCHEMA,
+                # Idle-only changes (altitude, ASC, FRC, ...) are coalesced into
+                # one Stop/Start window after this quiet period
+                cv.Optional(
+                    CONF_CONFIGURATION_DEBOUNCE, default="2s"
+                ): cv.positive_time_period_milliseconds,
+                # CRC lookup table (NIBBLE saves ~240 bytes on ESP8266)
+                cv.Optional(CONF_CRC_TABLE, default="FULL"): cv.one_of(
+                    *CRC_TABLES, upper=True
+                ),
+                cv.Optional(CONF_POLLING_MODE, default="INTERVAL"): cv.enum(
+                    POLLING_MODES, upper=True
+                ),
+                # Per-loop bus time shared by all SEN6x instances (0 = unlimited)
+                cv.Optional(
+                    CONF_BUS_TIME_BUDGET
+                ): cv.positive_time_period_microseconds,
+                # Suppress unchanged values on every channel without a deadband
+                cv.Optional(CONF_PUBLISH_ON_CHANGE_ONLY, default=False): cv.boolean,
+                cv.Optional(CONF_DECIMATION, default={}): DECIMATION_SCHEMA,
+                # Publish one windowed aggregate per channel at this interval
+                cv.Optional(
+                    CONF_AGGREGATION_INTERVAL
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(CONF_VOC_BASELINE, default={}): VOC_BASELINE_SCHEMA,
+                # Publish interval of the I2C/update() diagnostic sensors
+                cv.Optional(
+                    CONF_DIAGNOSTICS_INTERVAL, default="60s"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(CONF_CAPTURE): CAPTURE_SCHEMA,
+                cv.Optional(CONF_BURST): BURST_SCHEMA,
+                cv.Optional(CONF_DUTY_CYCLE): DUTY_CYCLE_SCHEMA,
+                cv.Optional(CONF_SENSOR_TASK): cv.All(
+                    SENSOR_TASK_SCHEMA, cv.only_on_esp32
+                ),
+                cv.Optional(
+                    CONF_CIRCUIT_BREAKER, default={}
+                ): CIRCUIT_BREAKER_SCHEMA,
+                cv.Optional(CONF_SHT_HEATER): SHT_HEATER_SCHEMA,
+                cv.Optional(
+                    CONF_CO2_CALIBRATION_GATE
+                ): CO2_CALIBRATION_GATE_SCHEMA,
+            }
+        )
+        .extend(cv.polling_component_schema("10s"))
+        .extend(i2c.i2c_device_schema(0x6B))
+    ),
+    validate_duty_cycle_model,
 )
 
 
+def get_pinned_model():
+    """Model shared by every sen6x instance if all of them pin the same one."""
+    models = {conf.get(CONF_MODEL) for conf in CORE.config.get("sen6x", [])}
+    if len(models) == 1 and None not in models:
+        return models.pop()
+    return None
+
+
 def get_model_capabilities(model):
     """Get capabilities for a specific model."""
     return MODEL_CAPABILITIES.get(model, MODEL_CAPABILITIES["SEN66"])
@@ -86,12 +432,42 @@ async def to_code(config):
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
 
-    # Model is auto-detected from sensor at runtime - no set_model() call needed
+    # The shared bus scheduler is registered once; its loop() resets the bus
+    # time budget at the start of every main-loop pass
+    if not CORE.data.get(KEY_BUS_SCHEDULER_REGISTERED):
+        CORE.data[KEY_BUS_SCHEDULER_REGISTERED] = True
+        scheduler = cg.Pvariable(
+            config[CONF_BUS_SCHEDULER_ID],
+            cg.RawExpression("&sen6x::global_sen6x_bus_scheduler"),
+        )
+        await cg.register_component(scheduler, {})
+
+    # Model is auto-detected from sensor at runtime unless pinned in YAML.
+    # When every instance pins the same model only its decoder is compiled.
+    if CONF_MODEL in config:
+        cg.add(var.set_model(MODEL_ENUM_MAP[config[CONF_MODEL]]))
+        pinned = get_pinned_model()
+        if pinned is not None:
+            cg.add_define("SEN6X_PINNED_MODEL", MODEL_ENUM_MAP[pinned])
 
     # Optional external pressure source for CO2 compensation
     if CONF_PRESSURE_SOURCE in config:
         pressure_sensor = await cg.get_variable(config[CONF_PRESSURE_SOURCE])
         cg.add(var.set_pressure_source(pressure_sensor))
+        pressure_filter = config[CONF_PRESSURE_FILTER]
+        cg.add(
+            var.set_pressure_filter(
+                pressure_filter[CONF_MODE],
+                pressure_filter[CONF_ALPHA],
+                pressure_filter[CONF_WINDOW],
+            )
+        )
+        cg.add(
+            var.set_pressure_rate_limit(
+                pressure_filter[CONF_MIN_INTERVAL].total_milliseconds,
+                pressure_filter[CONF_HYSTERESIS],
+            )
+        )
 
     # RHT Acceleration (YAML-only, volatile - applied on each boot)
     if CONF_RHT_ACCELERATION in config:
@@ -104,3 +480,192 @@ async def to_code(config):
             ("t2", rht[CONF_RHT_T2]),
         )
         cg.add(var.set_rht_acceleration(rht_struct))
+
+    # Idle configuration window debounce
+    cg.add(
+        var.set_idle_window_debounce(
+            config[CONF_CONFIGURATION_DEBOUNCE].total_milliseconds
+        )
+    )
+
+    # Measurement scheduling mode
+    cg.add(var.set_polling_mode(config[CONF_POLLING_MODE]))
+
+    # Change-only publishing (per-channel deadbands are set in sensor.py)
+    cg.add(var.set_publish_on_change_only(config[CONF_PUBLISH_ON_CHANGE_ONLY]))
+
+    # Polling decimation
+    decimation = config[CONF_DECIMATION]
+    for key, group in (
+        (CONF_FRAME, Sen6xPollGroup.FRAME),
+        (CONF_NUMBER_CONCENTRATION, Sen6xPollGroup.NUMBER_CONCENTRATION),
+        (CONF_STATUS, Sen6xPollGroup.STATUS),
+        (CONF_READBACK, Sen6xPollGroup.READBACK),
+    ):
+        cg.add(var.set_decimation(group, decimation[key]))
+
+    # Windowed aggregation: ring capacity covers one window of frames
+    if CONF_AGGREGATION_INTERVAL in config:
+        interval_ms = config[CONF_AGGREGATION_INTERVAL].total_milliseconds
+        frame_ms = (
+            config[CONF_UPDATE_INTERVAL].total_milliseconds
+            * decimation[CONF_FRAME]
+        )
+        capacity = min(255, max(1, -(-interval_ms // max(1, frame_ms))))
+        cg.add(var.set_aggregation(interval_ms, capacity))
+
+    # VOC baseline persistence
+    baseline = config[CONF_VOC_BASELINE]
+    cg.add(var.set_store_baseline(baseline[CONF_STORE]))
+    cg.add(
+        var.set_baseline_store_policy(
+            baseline[CONF_MIN_INTERVAL].total_milliseconds, baseline[CONF_MAX_DIFF]
+        )
+    )
+
+    # Diagnostic sensors (configured in sensor.py)
+    cg.add(
+        var.set_diagnostics_interval(
+            config[CONF_DIAGNOSTICS_INTERVAL].total_milliseconds
+        )
+    )
+
+    # Raw response capture (compiled in only when configured)
+    if CONF_CAPTURE in config:
+        cg.add_define("USE_SEN6X_CAPTURE")
+        cg.add(var.set_capture_buffer_size(config[CONF_CAPTURE][CONF_BUFFER_SIZE]))
+
+    # Burst sampling (also enabled by the burst switch or actions)
+    if CONF_BURST in config:
+        burst = config[CONF_BURST]
+        cg.add_define("USE_SEN6X_BURST")
+        cg.add(
+            var.set_burst(
+                burst[CONF_INTERVAL].total_milliseconds,
+                burst[CONF_DURATION].total_milliseconds,
+            )
+        )
+        for key, channel in BURST_TRIGGERS.items():
+            if key in burst:
+                cg.add(var.add_burst_trigger(channel, burst[key]))
+
+    # Duty-cycled measurement (update_interval polls while awake)
+    if CONF_DUTY_CYCLE in config:
+        duty = config[CONF_DUTY_CYCLE]
+        cg.add_define("USE_SEN6X_DUTY_CYCLE")
+        cg.add(var.set_duty_cycle(duty[CONF_PERIOD].total_milliseconds))
+        for key, (group, _) in WARM_UP_GROUPS.items():
+            cg.add(
+                var.set_warm_up(group, duty[CONF_WARM_UP][key].total_milliseconds)
+            )
+
+    # Sensor task (bus reads off the main loop, ESP32 only)
+    if CONF_SENSOR_TASK in config:
+        task = config[CONF_SENSOR_TASK]
+        cg.add_define("USE_SEN6X_SENSOR_TASK")
+        cg.add(
+            var.set_sensor_task(
+                task[CONF_CORE], task[CONF_PRIORITY], task[CONF_STACK_SIZE]
+            )
+        )
+
+    # Shared bus scheduler budget (applies to all instances)
+    if CONF_BUS_TIME_BUDGET in config:
+        cg.add(
+            var.set_bus_time_budget(
+                config[CONF_BUS_TIME_BUDGET].total_microseconds
+            )
+        )
+
+    # Bus-fault circuit breaker
+    breaker = config[CONF_CIRCUIT_BREAKER]
+    cg.add(
+        var.set_circuit_breaker(
+            breaker[CONF_FAILURE_THRESHOLD],
+            breaker[CONF_BACKOFF].total_milliseconds,
+            breaker[CONF_MAX_BACKOFF].total_milliseconds,
+        )
+    )
+
+    if CONF_SHT_HEATER in config:
+        heater = config[CONF_SHT_HEATER]
+        min_humidity = cg.RawExpression("NAN")
+        if CONF_MIN_HUMIDITY in heater:
+            min_humidity = heater[CONF_MIN_HUMIDITY] * 100.0
+        cg.add(
+            var.set_sht_heater_schedule(
+                heater[CONF_INTERVAL].total_milliseconds, min_humidity
+            )
+        )
+
+    if CONF_CO2_CALIBRATION_GATE in config:
+        gate = config[CONF_CO2_CALIBRATION_GATE]
+        max_deviation = cg.RawExpression("NAN")
+        if CONF_MAX_DEVIATION in gate:
+            max_deviation = float(gate[CONF_MAX_DEVIATION])
+        cg.add(
+            var.set_co2_calibration_gate(
+                gate[CONF_SAMPLES], gate[CONF_MAX_SPREAD], max_deviation
+            )
+        )
+
+    # CRC-8 lookup table selection (compile-time)
+    if config[CONF_CRC_TABLE] == "NIBBLE":
+        cg.add_define("SEN6X_CRC_NIBBLE_TABLE")
+
+
+# ========== ACTIONS ==========
+
+BURST_ACTION_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.use_id(Sen6xComponent),
+})
+
+
+@automation.register_action(
+    "sen6x.start_burst",
+    StartBurstAction,
+    BURST_ACTION_SCHEMA.extend({
+        # Defaults to burst: duration
+        cv.Optional(CONF_DURATION): cv.templatable(
+            cv.positive_time_period_milliseconds
+        ),
+    }),
+)
+async def start_burst_to_code(config, action_id, template_arg, args):
+    cg.add_define("USE_SEN6X_BURST")
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    if CONF_DURATION in config:
+        duration = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+        cg.add(var.set_duration(duration))
+    return var
+
+
+@automation.register_action(
+    "sen6x.stop_burst", StopBurstAction, BURST_ACTION_SCHEMA
+)
+async def stop_burst_to_code(config, action_id, template_arg, args):
+    cg.add_define("USE_SEN6X_BURST")
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sen6x.forced_co2_calibration",
+    ForcedCo2CalibrationAction,
+    cv.Schema({
+        cv.GenerateID(): cv.use_id(Sen6xComponent),
+        # Defaults to the outdoor CO2 reference
+        cv.Optional(CONF_REFERENCE): cv.templatable(
+            cv.float_range(min=0, max=65535)
+        ),
+    }),
+)
+async def forced_co2_calibration_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    if CONF_REFERENCE in config:
+        reference = await cg.templatable(config[CONF_REFERENCE], args, float)
+        cg.add(var.set_reference(reference))
+    return var
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Automation actions: sen6x.start_burst / sen6x.stop_burst /
+// sen6x.forced_co2_calibration
+
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "sen6x.h"
+
+namespace esphome {
+namespace sen6x {
+
+template<typename... Ts>
+class StartBurstAction : public Action<Ts...>, public Parented<Sen6xComponent> {
+public:
+  TEMPLATABLE_VALUE(uint32_t, duration)
+
+  // Duration 0 uses the configured burst duration
+  void play(Ts... x) override {
+    this->parent_->start_burst(this->duration_.value_or(x..., 0));
+  }
+};
+
+template<typename... Ts>
+class StopBurstAction : public Action<Ts...>, public Parented<Sen6xComponent> {
+public:
+  void play(Ts... x) override { this->parent_->stop_burst(); }
+};
+
+template<typename... Ts>
+class ForcedCo2CalibrationAction : public Action<Ts...>,
+                                   public Parented<Sen6xComponent> {
+public:
+  TEMPLATABLE_VALUE(float, reference)
+
+  // No reference uses the outdoor CO2 reference
+  void play(Ts... x) override {
+    this->parent_->start_forced_co2_calibration(
+        this->reference_.value_or(x..., NAN));
+  }
+};
+
+} // namespace sen6x
+} // namespace esphome
@@ -12,6 +12,7 @@ CONF_RHT_ERROR = "rht_error"
 CONF_PM_ERROR = "pm_error"
 CONF_LASER_ERROR = "laser_error"
 CONF_FAN_CLEANING_ACTIVE = "fan_cleaning_active"
+CONF_BUS_FAULT = "bus_fault"
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_SEN6X_ID): cv.use_id(Sen6xComponent),
@@ -49,10 +50,17 @@ CONFIG_SCHEMA = {
         entity_category="diagnostic",
         icon="mdi:broom",
     ),
+    # ON while the bus-fault circuit breaker keeps the sensor off the bus
+    cv.Optional(CONF_BUS_FAULT): binary_sensor.binary_sensor_schema(
+        device_class="problem",
+        entity_category="diagnostic",
+        icon="mdi:lan-disconnect",
+    ),
 }
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
+    cg.add_define("USE_SEN6X_BINARY_SENSOR")
 
     if CONF_FAN_ERROR in config:
         sens = await binary_sensor.new_binary_sensor(config[CONF_FAN_ERROR])
@@ -82,3 +90,7 @@ async def to_code(config):
         sens = await binary_sensor.new_binary_sensor(config[CONF_FAN_CLEANING_ACTIVE])
         cg.add(hub.set_fan_cleaning_active_binary_sensor(sens))
 
+    if CONF_BUS_FAULT in config:
+        sens = await binary_sensor.new_binary_sensor(config[CONF_BUS_FAULT])
+        cg.add(hub.set_bus_fault_binary_sensor(sens))
+
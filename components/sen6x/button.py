@@ -3,7 +3,11 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import button
-from esphome.const import CONF_ID, ENTITY_CATEGORY_CONFIG
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_CONFIG,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+)
 from . import Sen6xComponent, CONF_SEN6X_ID
 
 CONF_FAN_CLEANING = "fan_cleaning"
@@ -13,6 +17,7 @@ CONF_FORCE_CO2_CALIBRATION = "force_co2_calibration"
 CONF_CO2_FACTORY_RESET = "co2_factory_reset"
 CONF_SHT_HEATER = "sht_heater"
 CONF_CLEAR_DEVICE_STATUS = "clear_device_status"
+CONF_DUMP_CAPTURE = "dump_capture"
 
 sen6x_ns = cg.esphome_ns.namespace("sen6x")
 Sen6xButton = sen6x_ns.class_("Sen6xButton", button.Button)
@@ -54,10 +59,17 @@ CONFIG_SCHEMA = {
         icon="mdi:eraser",
         entity_category=ENTITY_CATEGORY_CONFIG,
     ),
+    # Logs the raw capture ring (needs 'capture:' on the hub)
+    cv.Optional(CONF_DUMP_CAPTURE): button.button_schema(
+        Sen6xButton,
+        icon="mdi:file-download",
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
 }
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
+    cg.add_define("USE_SEN6X_BUTTON")
 
     if CONF_FAN_CLEANING in config:
         b = await button.new_button(config[CONF_FAN_CLEANING])
@@ -87,3 +99,6 @@ async def to_code(config):
         b = await button.new_button(config[CONF_CLEAR_DEVICE_STATUS])
         cg.add(hub.set_clear_device_status_button(b))
 
+    if CONF_DUMP_CAPTURE in config:
+        b = await button.new_button(config[CONF_DUMP_CAPTURE])
+        cg.add(hub.set_dump_capture_button(b))
@@ -6,40 +6,160 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 namespace esphome {
 namespace sen6x {
 
+// All three TVOC estimates are linear in one term of the VOC Index,
+//   T = 6.24 - ln(501 - voc_index)
+// and differ only in the factor applied to it (AppNote conversion factors)
+static constexpr float SEN6X_TVOC_OFFSET = 6.24f;
+static constexpr float SEN6X_TVOC_WELL_FACTOR = 996.94f;    // Molhave, ug/m3
+static constexpr float SEN6X_TVOC_RESET_FACTOR = 878.53f;   // Isobutylene
+static constexpr float SEN6X_TVOC_ETHANOL_FACTOR = 381.97f; // Ethanol, ppb
+
+// The raw VOC word is the index x10, so 501 - voc_index = (5010 - raw) / 10
+// with an integer numerator n. ln(n) comes from a table of ln(m) for
+// m = 128..256: n is shifted into that range and the low bits dropped by
+// the shift interpolated between neighbours (error < 1e-5), so a raw
+// sample needs no log call. 129 floats (516 bytes) instead of a 5000-entry
+// table, since ESP8266 keeps const data in RAM.
+static constexpr uint16_t SEN6X_LN_TABLE_BASE = 128;
+static constexpr uint8_t SEN6X_LN_TABLE_SHIFT = 7; // log2(base)
+static constexpr double SEN6X_LN2 = 0.69314718055994530942;
+static constexpr float SEN6X_LN10 = 2.30258509299404568402f;
+static constexpr int16_t SEN6X_VOC_RAW_LIMIT = 5010; // voc_index 501
+
+// Compile-time ln for x in [1, 2] (atanh series, converges for s <= 1/3)
+constexpr double sen6x_ln_1_2(double x) {
+  double s = (x - 1.0) / (x + 1.0);
+  double s2 = s * s;
+  double power = s;
+  double sum = 0.0;
+  for (int k = 1; k < 40; k += 2) {
+    sum += power / k;
+    power *= s2;
+  }
+  return 2.0 * sum;
+}
+
+struct Sen6xLnTable {
+  float entries[SEN6X_LN_TABLE_BASE + 1];
+  constexpr Sen6xLnTable() : entries() {
+    for (uint16_t i = 0; i <= SEN6X_LN_TABLE_BASE; i++)
+      entries[i] = (float)(SEN6X_LN_TABLE_SHIFT * SEN6X_LN2 +
+                           sen6x_ln_1_2(1.0 + (double)i / SEN6X_LN_TABLE_BASE));
+  }
+};
+
+static constexpr Sen6xLnTable SEN6X_LN_TABLE{};
+
+// ln(128) = 4.8520303, ln(256) = 5.5451774
+static_assert(SEN6X_LN_TABLE.entries[0] > 4.85203f &&
+                  SEN6X_LN_TABLE.entries[0] < 4.852031f &&
+                  SEN6X_LN_TABLE.entries[SEN6X_LN_TABLE_BASE] > 5.545177f &&
+                  SEN6X_LN_TABLE.entries[SEN6X_LN_TABLE_BASE] < 5.545178f,
+              "ln table reference mismatch");
+
+// ln(n) for 1 <= n < 2^16 from the table (no log call)
+inline float sen6x_ln_u16(uint16_t n) {
+  if (n == 0)
+    return -INFINITY;
+  int8_t exponent = 0; // n = m * 2^exponent, 128 <= m < 256
+  while (n < SEN6X_LN_TABLE_BASE) {
+    n <<= 1;
+    exponent--;
+  }
+  uint32_t m = n;
+  uint32_t remainder = 0;
+  while (m >= 2U * SEN6X_LN_TABLE_BASE) {
+    remainder |= (m & 1U) << exponent;
+    m >>= 1;
+    exponent++;
+  }
+  float ln_m = SEN6X_LN_TABLE.entries[m - SEN6X_LN_TABLE_BASE];
+  if (remainder != 0) {
+    float step = SEN6X_LN_TABLE.entries[m - SEN6X_LN_TABLE_BASE + 1] - ln_m;
+    ln_m += step * (float)remainder / (float)(1U << exponent);
+  }
+  return ln_m + (float)exponent * (float)SEN6X_LN2;
+}
+
+// TVOC estimates of one sample or the mean over a window of samples
+struct Sen6xDerivedMetrics {
+  uint8_t count; // Samples with a valid VOC Index (> 0)
+  float tvoc_well;
+  float tvoc_reset;
+  float tvoc_ethanol;
+};
+
 class EnvironmentalPhysics {
 public:
-  // Calculate TVOC for WELL Building Standard (Molhave equivalent)
-  // Based on Sensirion AQI_BuildingStandards AppNote
-  static float calculate_well_tvoc(float voc_index) {
+  // T for a raw VOC word (index x10), 0 at and above voc_index 501
+  static float tvoc_term(int16_t voc_raw) {
+    if (voc_raw >= SEN6X_VOC_RAW_LIMIT)
+      return 0.0f;
+    // 6.24 - ln((5010 - raw) / 10)
+    return SEN6X_TVOC_OFFSET + SEN6X_LN10 -
+           sen6x_ln_u16((uint16_t)(SEN6X_VOC_RAW_LIMIT - voc_raw));
+  }
+  // T for a VOC Index value that is not a raw word (one log)
+  static float tvoc_term(float voc_index) {
     if (voc_index >= 501)
       return 0.0f;
     if (voc_index > 500.9f)
       voc_index = 500.9f;
-    return (std::log(501.0f - voc_index) - 6.24f) * -996.94f;
+    return SEN6X_TVOC_OFFSET - std::log(501.0f - voc_index);
+  }
+
+  // All estimates of one decoded frame's VOC word in one pass
+  static Sen6xDerivedMetrics derive(int16_t voc_raw) {
+    if (voc_raw <= 0)
+      return Sen6xDerivedMetrics{0, NAN, NAN, NAN};
+    return from_term_(tvoc_term(voc_raw), 1);
+  }
+  // Window mean of the per-sample estimates (raw VOC words from the
+  // aggregation ring, any order). T is summed once; the estimates are
+  // linear in it, so this equals averaging each estimate separately.
+  static Sen6xDerivedMetrics derive(const uint16_t *voc_raw, uint8_t count) {
+    float sum = 0.0f;
+    uint8_t valid = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      int16_t raw = (int16_t)voc_raw[i];
+      if (raw <= 0)
+        continue;
+      sum += tvoc_term(raw);
+      valid++;
+    }
+    if (valid == 0)
+      return Sen6xDerivedMetrics{0, NAN, NAN, NAN};
+    return from_term_(sum / valid, valid);
+  }
+
+  // Calculate TVOC for WELL Building Standard (Molhave equivalent)
+  // Based on Sensirion AQI_BuildingStandards AppNote
+  static float calculate_well_tvoc(float voc_index) {
+    return tvoc_term(voc_index) * SEN6X_TVOC_WELL_FACTOR;
   }
 
   // Calculate TVOC for RESET Air (Isobutylene equivalent)
   // Based on Sensirion AQI_BuildingStandards AppNote
   static float calculate_reset_tvoc(float voc_index) {
-    if (voc_index >= 501)
-      return 0.0f;
-    if (voc_index > 500.9f)
-      voc_index = 500.9f;
-    return (std::log(501.0f - voc_index) - 6.24f) * -878.53f;
+    return tvoc_term(voc_index) * SEN6X_TVOC_RESET_FACTOR;
   }
 
   // Calculate TVOC Ethanol (ppb)
   // Based on Sensirion AQI_BuildingStandards AppNote
   static float calculate_ethanol_tvoc(float voc_index) {
-    if (voc_index >= 501)
-      return 0.0f;
-    if (voc_index > 500.9f)
-      voc_index = 500.9f;
-    return (std::log(501.0f - voc_index) - 6.24f) * -381.97f;
+    return tvoc_term(voc_index) * SEN6X_TVOC_ETHANOL_FACTOR;
+  }
+
+protected:
+  static Sen6xDerivedMetrics from_term_(float term, uint8_t count) {
+    return Sen6xDerivedMetrics{count, term * SEN6X_TVOC_WELL_FACTOR,
+                               term * SEN6X_TVOC_RESET_FACTOR,
+                               term * SEN6X_TVOC_ETHANOL_FACTOR};
   }
 };
 
@@ -58,6 +58,7 @@ CONFIG_SCHEMA = {
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
+    cg.add_define("USE_SEN6X_NUMBER")
 
     if CONF_ALTITUDE_COMPENSATION in config:
         n = await number.new_number(config[CONF_ALTITUDE_COMPENSATION], min_value=0, max_value=3000, step=1)
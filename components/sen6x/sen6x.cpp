@@ -2,10 +2,15 @@
 
 #include "sen6x.h"
 #include "environmental_physics.h"
+#include "sen6x_aggregation.h"
+#include "sen6x_bus_scheduler.h"
+#include "sen6x_crc.h"
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <sys/stat.h>
 
@@ -20,50 +25,107 @@ namespace esphome {
 namespace sen6x {
 
 using namespace esphome::sensor;
+#ifdef USE_SEN6X_TEXT_SENSOR
 using namespace esphome::text_sensor;
+#endif
+#ifdef USE_SEN6X_BINARY_SENSOR
 using namespace esphome::binary_sensor;
+#endif
 
 static const char *const TAG = "sen6x";
 
-uint8_t sen6x_crc(const uint8_t *data, uint8_t len) {
-  uint8_t crc = 0xFF;
+Sen6xBusScheduler global_sen6x_bus_scheduler; // NOLINT
+
+// Identity string from a 16-word response: NUL terminated, NUL padded
+static void sen6x_words_to_string(const uint16_t *words, uint8_t count,
+                                  char *text) {
+  std::memset(text, 0, SEN6X_IDENTITY_STRING_LEN + 1);
+  uint8_t len = std::min<uint8_t>(count * 2, SEN6X_IDENTITY_STRING_LEN);
   for (uint8_t i = 0; i < len; i++) {
-    crc ^= data[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      if ((crc & 0x80) != 0)
-        crc = (uint8_t)((crc << 1) ^ 0x31);
-      else
-        crc <<= 1;
-    }
+    char c = (char)((i % 2 == 0) ? words[i / 2] >> 8 : words[i / 2] & 0xFF);
+    if (c == 0)
+      break;
+    text[i] = c;
   }
-  return crc;
 }
 
 void Sen6xComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up SEN6x...");
+  this->bus_slot_ = global_sen6x_bus_scheduler.register_device();
+  this->baseline_update_interval_ms_ = this->get_update_interval();
+  this->setup_aggregation_();
+#ifdef USE_SEN6X_DIAGNOSTICS
+  this->set_interval("diagnostics", this->diagnostics_interval_ms_,
+                     [this]() { this->diagnostics_.publish(); });
+#endif
+#ifdef USE_SEN6X_CAPTURE
+  this->capture_ring_.allocate(this->capture_buffer_size_);
+#endif
+#ifdef USE_SEN6X_SENSOR_TASK
+  // Single-core chips only have core 0
+  BaseType_t core = std::min<BaseType_t>(this->sensor_task_core_,
+                                         portNUM_PROCESSORS - 1);
+  if (xTaskCreatePinnedToCore(Sen6xComponent::sensor_task_entry_, "sen6x",
+                              this->sensor_task_stack_size_, this,
+                              this->sensor_task_priority_, &this->sensor_task_,
+                              core) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create sensor task, reading from the main loop");
+    this->sensor_task_ = nullptr;
+  }
+#endif
+
+  // Boot runs as a phased state machine on the transaction queue so other
+  // components come up in parallel: STOPPING -> CONFIGURING -> STARTING ->
+  // POST_START -> READY. setup() only kicks it off and wires callbacks.
 
   // Force Stop Measurement to ensure Idle Mode for configuration
   // This handles cases where ESP32 resets but Sensor is still running
   // Datasheet requires > 1400ms after stop command
-  this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-  delay(1500); // Allow sensor to stop and enter Idle Mode
+  this->boot_phase_ = Sen6xBootPhase::STOPPING;
+  this->stop_measurement_(
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (ok) {
+          this->boot_configure_();
+          return;
+        }
+        // A failed Stop returns at once; the sensor may still be stopping
+        ESP_LOGW(TAG, "Stop measurement not acknowledged, continuing");
+        this->set_timeout("boot_stop", SEN6X_STOP_MEASUREMENT_TIME_MS,
+                          [this]() { this->boot_configure_(); });
+      });
+
+  this->register_control_callbacks_();
+}
+
+void Sen6xComponent::boot_configure_() {
+  this->boot_phase_ = Sen6xBootPhase::CONFIGURING;
 
   // Read Serial Number FIRST to generate preference hash
   // This ensures unique preference storage per sensor (same as SEN5x official)
-  uint8_t serial_buffer[32];
-  if (this->read_bytes_(SEN6X_CMD_GET_SERIAL_NUMBER, serial_buffer, 32)) {
-    // Use first 4 bytes for hash (creates unique ID per sensor)
-    this->preference_hash_ = (serial_buffer[0] << 24) |
-                             (serial_buffer[1] << 16) |
-                             (serial_buffer[2] << 8) | serial_buffer[3];
-    ESP_LOGI(TAG, "Serial-based preference hash: 0x%08X",
-             (unsigned int)this->preference_hash_);
-  } else {
-    // Fallback to fixed hash if serial read fails (backward compatible)
-    this->preference_hash_ = 0x6181DEAD;
-    ESP_LOGW(TAG, "Failed to read serial, using fallback preference hash");
-  }
+  this->queue_read_(
+      SEN6X_CMD_GET_SERIAL_NUMBER, 16,
+      [this](bool ok, const uint16_t *serial_words, uint8_t words) {
+        if (ok) {
+          // Use first 4 bytes for hash (creates unique ID per sensor)
+          this->preference_hash_ =
+              ((uint32_t)serial_words[0] << 16) | serial_words[1];
+          ESP_LOGI(TAG, "Serial-based preference hash: 0x%08X",
+                   (unsigned int)this->preference_hash_);
+          // Kept for the identity; read_device_identity_() does not re-read
+          sen6x_words_to_string(serial_words, words,
+                                this->identity_.serial_number);
+          this->serial_number_valid_ = true;
+        } else {
+          // Fallback to fixed hash if serial read fails (backward compatible)
+          this->preference_hash_ = 0x6181DEAD;
+          ESP_LOGW(TAG,
+                   "Failed to read serial, using fallback preference hash");
+        }
+        this->boot_apply_idle_configuration_();
+      });
+}
 
+void Sen6xComponent::boot_apply_idle_configuration_() {
   // Apply Volatile Configuration (if enabled)
   // Must be done in Idle Mode (before measurement starts)
   // 1. Initialize Preferences & Restore Configuration
@@ -92,188 +154,206 @@ void Sen6xComponent::setup() {
     this->write_rht_acceleration_(rht);
   }
 
+  // Persisted configuration: one record load (keyed by serial)
+  this->load_config_();
+  this->load_rolling_averages_();
+
   // VOC Baseline Persistence (same as SEN5x official)
   // Restore saved VOC algorithm state for faster startup (skips 12h+ learning)
   if (this->store_baseline_) {
-    this->voc_baseline_preference_ =
-        global_preferences->make_preference<Sen6xBaselines>(
-            this->preference_hash_ + 2, true);
-
-    if (this->voc_baseline_preference_.load(&this->voc_baselines_storage_)) {
-      ESP_LOGI(TAG, "Loaded VOC baseline state0: 0x%08X, state1: 0x%08X",
-               (unsigned int)this->voc_baselines_storage_.state0,
-               (unsigned int)this->voc_baselines_storage_.state1);
-
-      if (this->voc_baselines_storage_.state0 != 0 &&
-          this->voc_baselines_storage_.state1 != 0) {
-        // Write VOC algorithm state to sensor (must be in Idle mode)
-        // Command 0x6181: TX 8 bytes (4 x uint16 with CRC)
-        uint16_t states[4];
-        states[0] = (this->voc_baselines_storage_.state0 >> 16) & 0xFFFF;
-        states[1] = this->voc_baselines_storage_.state0 & 0xFFFF;
-        states[2] = (this->voc_baselines_storage_.state1 >> 16) & 0xFFFF;
-        states[3] = this->voc_baselines_storage_.state1 & 0xFFFF;
-
-        // Write command with data (4 words = 8 bytes + CRC)
-        uint8_t cmd_buffer[2 + 12]; // 2 cmd + 4*(2 data + 1 crc)
-        cmd_buffer[0] = SEN6X_CMD_VOC_ALGORITHM_STATE >> 8;
-        cmd_buffer[1] = SEN6X_CMD_VOC_ALGORITHM_STATE & 0xFF;
-        for (int i = 0; i < 4; i++) {
-          cmd_buffer[2 + i * 3] = states[i] >> 8;
-          cmd_buffer[2 + i * 3 + 1] = states[i] & 0xFF;
-          cmd_buffer[2 + i * 3 + 2] = sen6x_crc(&cmd_buffer[2 + i * 3], 2);
-        }
-
-        if (this->write(cmd_buffer, sizeof(cmd_buffer)) == i2c::ERROR_OK) {
-          ESP_LOGI(TAG, "Restored VOC algorithm state from NVS");
-        } else {
-          ESP_LOGW(TAG, "Failed to restore VOC algorithm state");
-        }
-        delay(20); // Per datasheet execution time
-      }
-    }
-    this->seconds_since_last_baseline_store_ = 0;
+    this->restore_voc_baseline_();
+    this->last_baseline_store_ms_ = millis();
+    this->last_baseline_check_ms_ = this->last_baseline_store_ms_;
   }
 
-  // CO2 ASC
-  this->co2_asc_preference_ =
-      global_preferences->make_preference<bool>(this->preference_hash_ + 3);
-  bool co2_asc_state = true; // Default ON (Datasheet)
-  if (this->co2_asc_preference_.load(&co2_asc_state)) {
-    ESP_LOGI(TAG, "Restored CO2 ASC: %s", co2_asc_state ? "ON" : "OFF");
-  }
+  // CO2 ASC (default ON per datasheet)
+  bool co2_asc_state = this->config_.co2_asc;
+  ESP_LOGI(TAG, "CO2 ASC: %s", co2_asc_state ? "ON" : "OFF");
   this->write_co2_asc_(co2_asc_state);
+#ifdef USE_SEN6X_SWITCH
   if (this->co2_asc_switch_ != nullptr) {
     this->co2_asc_switch_->publish_state(co2_asc_state);
   }
+#endif
 
-  // Auto Fan Cleaning (switch in HA, persisted, interval from YAML)
-  this->auto_cleaning_preference_ =
-      global_preferences->make_preference<bool>(this->preference_hash_ + 4);
-  bool auto_clean_state = false; // Default OFF
-  if (this->auto_cleaning_preference_.load(&auto_clean_state)) {
-    ESP_LOGI(TAG, "Restored Auto Cleaning: %s",
-             auto_clean_state ? "ON" : "OFF");
-  }
+  // Auto Fan Cleaning (switch in HA, persisted, interval from YAML). Fan
+  // runtime is counted whether or not auto cleaning is on.
+  this->load_cleaning_record_();
+  this->last_runtime_tick_ms_ = millis();
+  this->set_interval("fan_runtime", SEN6X_FAN_RUNTIME_TICK_MS,
+                     [this]() { this->tick_fan_runtime_(); });
+  bool auto_clean_state = this->config_.auto_cleaning; // Default OFF
   if (auto_clean_state) {
+    ESP_LOGI(TAG, "Restored Auto Cleaning: ON");
     this->configure_auto_cleaning_(true);
   }
+#ifdef USE_SEN6X_SWITCH
   if (this->auto_cleaning_switch_ != nullptr) {
     this->auto_cleaning_switch_->publish_state(auto_clean_state);
   }
+#endif
+
+  // Periodic SHT heater cycles (high-humidity sites)
+  if (this->sht_heater_interval_ms_ > 0)
+    this->set_interval("sht_heater", this->sht_heater_interval_ms_,
+                       [this]() { this->run_scheduled_sht_heater_(); });
 
   // ========== IDLE-MODE CONFIGURATION (apply before Start Measurement)
   // ========== Commands that ONLY work in Idle Mode: Altitude, VOC Tuning,
   // CO2 ASC
 
   // Altitude - IMMEDIATE APPLICATION (Idle mode only per datasheet 4.8.38)
-  this->altitude_preference_ =
-      global_preferences->make_preference<float>(this->preference_hash_ + 5);
-  float restored_altitude = NAN; // Initialize to NAN to detect if load fails
-  bool has_altitude_pref = this->altitude_preference_.load(&restored_altitude);
+  float restored_altitude = this->config_.altitude; // NAN = not set
 
   // Store for later diagnostic logging (setup logs happen before API
-  // connects)
-  this->pending_altitude_ = has_altitude_pref ? restored_altitude : NAN;
+  // connects); stays NAN unless the value came from NVS
+  this->pending_altitude_ = restored_altitude;
 
-  if (has_altitude_pref && !std::isnan(restored_altitude)) {
+  if (!std::isnan(restored_altitude)) {
     // Apply immediately in Idle mode (before Start Measurement)
     ESP_LOGI(TAG, "Applying Altitude from NVS: %.1f m", restored_altitude);
-    if (this->write_altitude_compensation_(restored_altitude)) {
-      ESP_LOGI(TAG, "Altitude write SUCCESS");
-      if (this->altitude_compensation_number_ != nullptr) {
-        this->altitude_compensation_number_->publish_state(restored_altitude);
-      }
-      // Verification read to confirm value was applied
-      uint16_t verify_data;
-      if (this->read_words_(SEN6X_CMD_GET_SENSOR_ALTITUDE, &verify_data, 1)) {
-        float verified = (int16_t)verify_data;
-        ESP_LOGI(TAG, "Altitude verification: sensor reports %.1f m", verified);
-        this->pending_altitude_ = verified; // Update with verified value
-      }
-    } else {
-      ESP_LOGW(TAG, "Altitude write FAILED");
+    this->write_altitude_compensation_(restored_altitude);
+#ifdef USE_SEN6X_NUMBER
+    if (this->altitude_compensation_number_ != nullptr) {
+      this->altitude_compensation_number_->publish_state(restored_altitude);
     }
+#endif
+    // Verification read to confirm value was applied
+    this->queue_read_(SEN6X_CMD_GET_SENSOR_ALTITUDE, 1,
+                      [this](bool ok, const uint16_t *data, uint8_t words) {
+                        if (!ok)
+                          return;
+                        float verified = (int16_t)data[0];
+                        ESP_LOGI(TAG,
+                                 "Altitude verification: sensor reports %.1f m",
+                                 verified);
+                        this->pending_altitude_ = verified;
+                      });
   } else {
-    // No preference or NAN: read from device
-    ESP_LOGI(TAG, "No valid Altitude preference (nan=%s), reading from device",
-             std::isnan(restored_altitude) ? "true" : "false");
-    uint16_t data;
-    if (this->read_words_(SEN6X_CMD_GET_SENSOR_ALTITUDE, &data, 1)) {
-      float value = (int16_t)data;
-      ESP_LOGI(TAG, "Read Altitude from device: %.1f m", value);
-      this->pending_altitude_ = value;
-      if (this->altitude_compensation_number_ != nullptr) {
-        this->altitude_compensation_number_->publish_state(value);
-      }
-    }
+    // No preference: read from device
+    ESP_LOGI(TAG, "No Altitude preference, reading from device");
+    this->queue_read_(
+        SEN6X_CMD_GET_SENSOR_ALTITUDE, 1,
+        [this](bool ok, const uint16_t *data, uint8_t words) {
+          if (!ok)
+            return;
+          float value = (int16_t)data[0];
+          ESP_LOGI(TAG, "Read Altitude from device: %.1f m", value);
+#ifdef USE_SEN6X_NUMBER
+          if (this->altitude_compensation_number_ != nullptr) {
+            this->altitude_compensation_number_->publish_state(value);
+          }
+#endif
+        });
   }
-  this->altitude_restored_ = true; // Mark as done (no deferred needed)
 
   // ========== START MEASUREMENT ==========
-  if (this->start_measurement_()) {
-    ESP_LOGI(TAG, "Measurement started.");
-    this->read_device_identity_();
-    this->read_device_configuration_();
-  } else {
-    ESP_LOGE(TAG, "Failed to start measurement!");
-    this->mark_failed();
+  this->start_measurement_(
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGE(TAG, "Failed to start measurement!");
+          this->boot_phase_ = Sen6xBootPhase::FAILED;
+          this->mark_failed();
+          return;
+        }
+        ESP_LOGI(TAG, "Measurement started.");
+        this->boot_post_start_();
+      });
+  this->boot_phase_ = Sen6xBootPhase::STARTING;
+}
+
+void Sen6xComponent::restore_voc_baseline_() {
+  const Sen6xBaselines &baselines = this->config_.voc_baselines;
+  if (baselines.state0 == 0 || baselines.state1 == 0)
     return;
-  }
+  ESP_LOGI(TAG, "Loaded VOC baseline state0: 0x%08X, state1: 0x%08X",
+           (unsigned int)baselines.state0, (unsigned int)baselines.state1);
+
+  // Write VOC algorithm state to sensor (must be in Idle mode)
+  // Command 0x6181: TX 8 bytes (4 x uint16 with CRC)
+  uint16_t states[4];
+  states[0] = (baselines.state0 >> 16) & 0xFFFF;
+  states[1] = baselines.state0 & 0xFFFF;
+  states[2] = (baselines.state1 >> 16) & 0xFFFF;
+  states[3] = baselines.state1 & 0xFFFF;
+
+  this->queue_write_(SEN6X_CMD_VOC_ALGORITHM_STATE, states, 4,
+                     [](bool ok, const uint16_t *data, uint8_t words) {
+                       if (ok) {
+                         ESP_LOGI(TAG, "Restored VOC algorithm state from NVS");
+                       } else {
+                         ESP_LOGW(TAG, "Failed to restore VOC algorithm state");
+                       }
+                     });
+}
+
+void Sen6xComponent::boot_post_start_() {
+  this->boot_phase_ = Sen6xBootPhase::POST_START;
+  this->read_device_identity_();
+  this->read_device_configuration_();
 
   // ========== MEASUREMENT-MODE CONFIGURATION (apply after Start) ==========
   // Commands that work in BOTH Idle and Measurement: Temp Offset, Pressure
   // No stop/start needed - write directly!
 
   // Ambient Pressure (works in Measurement mode per datasheet 4.8.36)
-  this->ambient_pressure_preference_ =
-      global_preferences->make_preference<float>(this->preference_hash_ + 6);
-  float restored_pressure = 0;
-  if (this->ambient_pressure_preference_.load(&restored_pressure) &&
-      !std::isnan(restored_pressure)) {
+  float restored_pressure = this->config_.ambient_pressure;
+  if (!std::isnan(restored_pressure)) {
     ESP_LOGI(TAG, "Applying Pressure during Measurement: %.1f hPa",
              restored_pressure);
-    if (this->write_ambient_pressure_compensation_(restored_pressure)) {
-      if (this->ambient_pressure_compensation_number_ != nullptr) {
-        this->ambient_pressure_compensation_number_->publish_state(
-            restored_pressure);
-      }
+    this->write_ambient_pressure_compensation_(restored_pressure);
+#ifdef USE_SEN6X_NUMBER
+    if (this->ambient_pressure_compensation_number_ != nullptr) {
+      this->ambient_pressure_compensation_number_->publish_state(
+          restored_pressure);
     }
+#endif
   } else {
-    uint16_t data;
-    if (this->read_words_(SEN6X_CMD_GET_AMBIENT_PRESSURE, &data, 1)) {
-      float value = (int16_t)data;
-      ESP_LOGI(TAG, "Read Pressure from device: %.1f hPa", value);
-      if (this->ambient_pressure_compensation_number_ != nullptr) {
-        this->ambient_pressure_compensation_number_->publish_state(value);
-      }
-    }
+    this->queue_read_(
+        SEN6X_CMD_GET_AMBIENT_PRESSURE, 1,
+        [this](bool ok, const uint16_t *data, uint8_t words) {
+          if (!ok)
+            return;
+          float value = (int16_t)data[0];
+          ESP_LOGI(TAG, "Read Pressure from device: %.1f hPa", value);
+#ifdef USE_SEN6X_NUMBER
+          if (this->ambient_pressure_compensation_number_ != nullptr) {
+            this->ambient_pressure_compensation_number_->publish_state(value);
+          }
+#else
+          (void)value;
+#endif
+        });
   }
 
   // Temperature Offset (works in Measurement mode per datasheet 4.8.14)
-  this->temperature_offset_preference_ =
-      global_preferences->make_preference<float>(this->preference_hash_ + 7);
-  float restored_offset = 0;
-  if (this->temperature_offset_preference_.load(&restored_offset) &&
-      !std::isnan(restored_offset)) {
+  float restored_offset = this->config_.temperature_offset;
+  if (!std::isnan(restored_offset)) {
     ESP_LOGI(TAG, "Applying Temp Offset during Measurement: %.2f C",
              restored_offset);
-    if (this->write_temperature_offset_(restored_offset)) {
-      if (this->temperature_offset_number_ != nullptr) {
-        this->temperature_offset_number_->publish_state(restored_offset);
-      }
+    this->write_temperature_offset_(restored_offset);
+#ifdef USE_SEN6X_NUMBER
+    if (this->temperature_offset_number_ != nullptr) {
+      this->temperature_offset_number_->publish_state(restored_offset);
     }
+#endif
   } else {
-    uint16_t data;
-    if (this->read_words_(SEN6X_CMD_SET_TEMP_OFFSET, &data, 1)) {
-      float value = (int16_t)data / 200.0f;
-      ESP_LOGI(TAG, "Read Temp Offset from device: %.2f C", value);
-      if (this->temperature_offset_number_ != nullptr) {
-        this->temperature_offset_number_->publish_state(value);
-      }
-    }
+    this->queue_read_(
+        SEN6X_CMD_SET_TEMP_OFFSET, 1,
+        [this](bool ok, const uint16_t *data, uint8_t words) {
+          if (!ok)
+            return;
+          float value = (int16_t)data[0] / 200.0f;
+          ESP_LOGI(TAG, "Read Temp Offset from device: %.2f C", value);
+#ifdef USE_SEN6X_NUMBER
+          if (this->temperature_offset_number_ != nullptr) {
+            this->temperature_offset_number_->publish_state(value);
+          }
+#else
+          (void)value;
+#endif
+        });
   }
-  this->temp_offset_restored_ = true; // Mark as done (no deferred needed)
 
   // Apply full temperature compensation if configured from YAML (slope +
   // time_constant)
@@ -284,25 +364,35 @@ void Sen6xComponent::setup() {
 
   // Outdoor CO2 Reference (for rebreathed_air calculation AND FRC
   // calibration)
-  this->outdoor_co2_reference_preference_ =
-      global_preferences->make_preference<float>(this->preference_hash_ + 8);
-  float restored_co2_ref = 400.0f;
-  if (this->outdoor_co2_reference_preference_.load(&restored_co2_ref)) {
+  float restored_co2_ref = this->config_.outdoor_co2_ppm;
+  if (!std::isnan(restored_co2_ref)) {
     ESP_LOGI(TAG, "Restored Outdoor CO2 Reference from NVS: %.0f ppm",
              restored_co2_ref);
     this->outdoor_co2_ppm_ = restored_co2_ref;
   }
+#ifdef USE_SEN6X_NUMBER
   if (this->outdoor_co2_reference_number_ != nullptr) {
     this->outdoor_co2_reference_number_->publish_state(this->outdoor_co2_ppm_);
+  }
+#endif
+  // POST_START completes (-> READY) once its queued transactions drain,
+  // see loop()
+}
+
+void Sen6xComponent::register_control_callbacks_() {
+#ifdef USE_SEN6X_NUMBER
+  if (this->outdoor_co2_reference_number_ != nullptr) {
     this->outdoor_co2_reference_number_->set_control_callback(
         [this](float value) {
           ESP_LOGI(TAG, "Setting Outdoor CO2 Reference: %.0f ppm", value);
           this->outdoor_co2_ppm_ = value;
-          this->outdoor_co2_reference_preference_.save(&value);
+          this->update_config_(this->config_.outdoor_co2_ppm, value);
           this->outdoor_co2_reference_number_->publish_state(value);
         });
   }
+#endif
 
+#ifdef USE_SEN6X_BUTTON
   // Register Button Callbacks
   if (this->fan_cleaning_button_ != nullptr) {
     this->fan_cleaning_button_->set_press_callback(
@@ -319,33 +409,8 @@ void Sen6xComponent::setup() {
 
   // FRC button: Forced CO2 Recalibration (uses outdoor_co2_ppm as reference)
   if (this->force_co2_calibration_button_ != nullptr) {
-    this->force_co2_calibration_button_->set_press_callback([this]() {
-      // Check model supports CO2
-      if (this->model_ != Sen6xModel::SEN63C &&
-          this->model_ != Sen6xModel::SEN66 &&
-          this->model_ != Sen6xModel::SEN69C) {
-        ESP_LOGW(TAG, "FRC not supported on this model (no CO2 sensor)");
-        return;
-      }
-
-      uint16_t ref_ppm = (uint16_t)this->outdoor_co2_ppm_;
-      ESP_LOGI(TAG, "Starting Forced CO2 Recalibration with reference: %d ppm",
-               ref_ppm);
-
-      // Per datasheet: Stop measurement -> wait 1400ms -> send FRC -> wait
-      // 500ms
-      this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-      this->set_timeout(1500, [this, ref_ppm]() {
-        if (this->perform_forced_co2_calibration_(ref_ppm)) {
-          ESP_LOGI(TAG, "FRC completed successfully - calibration persisted to "
-                        "sensor EEPROM");
-        } else {
-          ESP_LOGW(TAG, "FRC failed");
-        }
-        delay(100);
-        this->start_measurement_();
-      });
-    });
+    this->force_co2_calibration_button_->set_press_callback(
+        [this]() { this->start_forced_co2_calibration(); });
   }
 
   // CO2 Factory Reset button: Resets FRC/ASC calibration to factory defaults
@@ -365,76 +430,52 @@ void Sen6xComponent::setup() {
       ESP_LOGW(TAG, "This will erase FRC and ASC calibration history!");
 
       // Per datasheet: Stop measurement -> wait -> send command -> wait 1400ms
-      this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-      this->set_timeout(1500, [this]() {
-        if (this->write_command_(SEN6X_CMD_CO2_FACTORY_RESET)) {
-          ESP_LOGI(TAG, "CO2 Factory Reset sent successfully");
-          // Wait 1400ms for command execution (per datasheet)
-          this->set_timeout(1500, [this]() {
-            ESP_LOGI(TAG, "CO2 calibration reset to factory defaults");
-            this->start_measurement_();
-          });
-        } else {
-          ESP_LOGE(TAG, "CO2 Factory Reset command failed!");
-          this->start_measurement_();
-        }
-      });
+      this->request_idle_configuration_(Sen6xIdleAction::CO2_FACTORY_RESET);
     });
   }
 
   // SHT Heater button: Activate heater to remove condensation (0x6765)
   if (this->sht_heater_button_ != nullptr) {
-    this->sht_heater_button_->set_press_callback([this]() {
-      ESP_LOGI(TAG, "Activating SHT Heater for 1 second...");
-      ESP_LOGI(TAG,
-               "Wait at least 20s before measurement for accurate T values");
-
-      // Per datasheet: Available in Idle mode only, 1300ms execution time
-      this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-      this->set_timeout(1500, [this]() {
-        if (this->write_command_(SEN6X_CMD_ACTIVATE_SHT_HEATER)) {
-          ESP_LOGI(TAG, "SHT Heater activated (200mW for 1s)");
-          // Wait 20s before restarting measurement
-          this->set_timeout(20000, [this]() {
-            ESP_LOGI(TAG,
-                     "SHT Heater cooldown complete - restarting measurement");
-            this->start_measurement_();
-          });
-        } else {
-          ESP_LOGW(TAG, "Failed to activate SHT Heater");
-          this->start_measurement_();
-        }
-      });
-    });
+    this->sht_heater_button_->set_press_callback(
+        [this]() { this->activate_sht_heater(); });
   }
 
   // Clear Device Status button: Read and clear error flags (0xD210)
   if (this->clear_device_status_button_ != nullptr) {
     this->clear_device_status_button_->set_press_callback([this]() {
       ESP_LOGI(TAG, "Reading and clearing device status...");
-      uint16_t status_words[2]; // Device status is 2 words (4 bytes)
-      if (this->read_words_(SEN6X_CMD_READ_AND_CLEAR_STATUS, status_words, 2)) {
-        uint32_t status = ((uint32_t)status_words[0] << 16) | status_words[1];
-        ESP_LOGI(TAG, "Device status cleared. Previous status was: 0x%08X",
-                 status);
-      } else {
-        ESP_LOGW(TAG, "Failed to read and clear device status");
-      }
+      // Device status is 2 words (4 bytes)
+      this->queue_read_(
+          SEN6X_CMD_READ_AND_CLEAR_STATUS, 2,
+          [this](bool ok, const uint16_t *status_words, uint8_t words) {
+            if (!ok) {
+              ESP_LOGW(TAG, "Failed to read and clear device status");
+              return;
+            }
+            uint32_t status =
+                ((uint32_t)status_words[0] << 16) | status_words[1];
+            ESP_LOGI(TAG, "Device status cleared. Previous status was: 0x%08X",
+                     status);
+            // Re-read on the next cycle so the cleared flags are published
+            this->decimation_counter_[static_cast<uint8_t>(
+                Sen6xPollGroup::STATUS)] = 0;
+          });
     });
   }
+  if (this->dump_capture_button_ != nullptr) {
+    this->dump_capture_button_->set_press_callback(
+        [this]() { this->dump_capture(); });
+  }
+#endif
 
+#ifdef USE_SEN6X_NUMBER
   // Register Number Callbacks
   if (this->altitude_compensation_number_ != nullptr) {
     this->altitude_compensation_number_->set_control_callback([this](
                                                                   float value) {
-      ESP_LOGD(TAG, "Setting Altitude: %.1f m (Stopping measurement)", value);
-      this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-      // Wait 1500ms for sensor to stop (Datasheet spec)
-      this->set_timeout(1500, [this, value]() {
-        this->write_altitude_compensation_(value);
-        delay(50); // Ensure write processes
-        this->start_measurement_();
-      });
+      ESP_LOGD(TAG, "Setting Altitude: %.1f m (queued for idle window)",
+               value);
+      this->request_idle_configuration_(Sen6xIdleAction::ALTITUDE, value);
     });
   }
   if (this->ambient_pressure_compensation_number_ != nullptr) {
@@ -454,34 +495,43 @@ void Sen6xComponent::setup() {
       this->write_temperature_offset_(value);
     });
   }
+#endif
 
+#ifdef USE_SEN6X_SWITCH
   // Register Switch Callbacks
   // Note: voc_tuning_switch_ removed - VOC tuning is now YAML-only
 
   if (this->co2_asc_switch_ != nullptr) {
     this->co2_asc_switch_->set_write_callback([this](bool state) {
-      this->co2_asc_preference_.save(&state);
-      ESP_LOGD(TAG, "Setting CO2 ASC to %s", state ? "ON" : "OFF");
-
-      this->write_command_(SEN6X_CMD_STOP_MEASUREMENT);
-      this->set_timeout(1500, [this, state]() {
-        this->write_co2_asc_(state);
-        delay(50);
-        this->start_measurement_();
-        this->co2_asc_switch_->publish_state(state);
-      });
+      this->update_config_(this->config_.co2_asc, state);
+      ESP_LOGD(TAG, "Setting CO2 ASC to %s (queued for idle window)",
+               state ? "ON" : "OFF");
+      this->request_idle_configuration_(Sen6xIdleAction::CO2_ASC,
+                                        state ? 1.0f : 0.0f);
     });
   }
 
   // Auto Fan Cleaning switch callback
   if (this->auto_cleaning_switch_ != nullptr) {
     this->auto_cleaning_switch_->set_write_callback([this](bool state) {
-      this->auto_cleaning_preference_.save(&state);
+      this->update_config_(this->config_.auto_cleaning, state);
       this->configure_auto_cleaning_(state);
       this->auto_cleaning_switch_->publish_state(state);
     });
   }
 
+  // Burst switch: on starts a burst of the configured duration
+  if (this->burst_switch_ != nullptr) {
+    this->burst_switch_->set_write_callback([this](bool state) {
+      if (state) {
+        this->start_burst();
+      } else {
+        this->stop_burst();
+      }
+    });
+  }
+#endif
+
   // Subscribe to external pressure source for automatic CO2 compensation
   if (this->pressure_source_ != nullptr) {
     ESP_LOGI(TAG, "External pressure source configured - subscribing for CO2 "
@@ -496,598 +546,1404 @@ float Sen6xComponent::get_setup_priority() const {
 }
 
 void Sen6xComponent::read_device_identity_() {
-  uint8_t buffer[32];
-
-  // Read Product Name (0xD014)
-  if (this->read_bytes_(SEN6X_CMD_GET_PRODUCT_NAME, buffer, 32)) {
-    // Null-terminate or just construct string (buffer is raw bytes,
-    // potentially padded nulls at end) Reference says 32 bytes.
-    std::string product_name;
-    for (int i = 0; i < 32; i++) {
-      if (buffer[i] == 0)
-        break; // Stop at null
-      product_name += (char)buffer[i];
-    }
-    ESP_LOGI(TAG, "Product Name: %s", product_name.c_str());
-    if (this->product_name_text_sensor_ != nullptr) {
-      this->product_name_text_sensor_->publish_state(product_name);
-    }
-
-    // AUTO-DETECT MODEL from product name
-    // This eliminates the need for user to specify model in YAML
-    if (product_name.find("SEN62") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN62;
-      ESP_LOGI(TAG, "Auto-detected model: SEN62 (PM + RH/T)");
-    } else if (product_name.find("SEN63") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN63C;
-      ESP_LOGI(TAG, "Auto-detected model: SEN63C (PM + RH/T + CO2)");
-    } else if (product_name.find("SEN65") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN65;
-      ESP_LOGI(TAG, "Auto-detected model: SEN65 (PM + RH/T + VOC + NOx)");
-    } else if (product_name.find("SEN66") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN66;
-      ESP_LOGI(TAG, "Auto-detected model: SEN66 (PM + RH/T + VOC + NOx + CO2)");
-    } else if (product_name.find("SEN68") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN68;
-      ESP_LOGI(TAG,
-               "Auto-detected model: SEN68 (PM + RH/T + VOC + NOx + HCHO)");
-    } else if (product_name.find("SEN69") != std::string::npos) {
-      this->model_ = Sen6xModel::SEN69C;
-      ESP_LOGI(
-          TAG,
-          "Auto-detected model: SEN69C (PM + RH/T + VOC + NOx + CO2 + HCHO)");
-    } else {
-      ESP_LOGW(TAG, "Unknown product '%s', defaulting to SEN66 behavior",
-               product_name.c_str());
-      this->model_ = Sen6xModel::SEN66;
-    }
-
-    // ========== AUTO-HIDE UNSUPPORTED SENSORS (Core alignment with SEN5x)
-    // ========== Disable sensors that are not supported by the detected model
-    // This prevents publishing invalid data and cleans up HA entity list
-
-    // VOC: Only SEN65, SEN66, SEN68, SEN69C
-    bool has_voc = (this->model_ == Sen6xModel::SEN65 ||
-                    this->model_ == Sen6xModel::SEN66 ||
-                    this->model_ == Sen6xModel::SEN68 ||
-                    this->model_ == Sen6xModel::SEN69C);
-    if (this->voc_index_sensor_ != nullptr && !has_voc) {
-      ESP_LOGW(TAG, "VOC Index requires SEN65/66/68/69C - disabling sensor");
-      this->voc_index_sensor_->set_internal(true);
-      this->voc_index_sensor_ = nullptr;
+  // Warm boot: the record cached for this serial replaces the product name
+  // and firmware version reads
+  if (this->serial_number_valid_) {
+    ESPPreferenceObject preference =
+        global_preferences->make_preference<Sen6xIdentityRecord>(
+            this->preference_hash_ + SEN6X_IDENTITY_PREFERENCE_OFFSET, true);
+    Sen6xIdentityRecord cached;
+    if (preference.load(&cached) && cached.version == SEN6X_IDENTITY_VERSION &&
+        cached.model <= (uint8_t)Sen6xModel::SEN69C &&
+        std::memcmp(cached.serial_number, this->identity_.serial_number,
+                    sizeof(cached.serial_number)) == 0) {
+      cached.product_name[SEN6X_IDENTITY_STRING_LEN] = 0;
+      this->identity_ = cached;
+      ESP_LOGI(TAG, "Product Name: %s (cached)", this->identity_.product_name);
+      this->apply_model_((Sen6xModel)this->identity_.model);
+      this->publish_identity_(true);
+      return;
     }
+  }
 
-    // NOx: Only SEN65, SEN66, SEN68, SEN69C
-    bool has_nox = has_voc; // Same models as VOC
-    if (this->nox_sensor_ != nullptr && !has_nox) {
-      ESP_LOGW(TAG, "NOx Index requires SEN65/66/68/69C - disabling sensor");
-      this->nox_sensor_->set_internal(true);
-      this->nox_sensor_ = nullptr;
-    }
+  // Read Product Name (0xD014)
+  this->queue_read_(SEN6X_CMD_GET_PRODUCT_NAME, 16,
+                    [this](bool ok, const uint16_t *data, uint8_t words) {
+                      if (!ok)
+                        return;
+                      sen6x_words_to_string(data, words,
+                                            this->identity_.product_name);
+                      this->handle_product_name_(this->identity_.product_name);
+                    });
+
+  // Read Serial Number (0xD033) again only if the boot read failed
+  if (!this->serial_number_valid_) {
+    this->queue_read_(SEN6X_CMD_GET_SERIAL_NUMBER, 16,
+                      [this](bool ok, const uint16_t *data, uint8_t words) {
+                        if (ok)
+                          sen6x_words_to_string(data, words,
+                                                this->identity_.serial_number);
+                      });
+  }
+
+  // Read Firmware Version (0xD100): 2 bytes (Major + Minor) + CRC. Queued
+  // last, so its callback sees the other two reads completed.
+  this->queue_read_(SEN6X_CMD_GET_VERSION, 1,
+                    [this](bool ok, const uint16_t *data, uint8_t words) {
+                      if (ok) {
+                        this->identity_.firmware_major = (data[0] >> 8) & 0xFF;
+                        this->identity_.firmware_minor = data[0] & 0xFF;
+                      }
+                      this->finish_device_identity_(ok);
+                    });
+}
 
-    // CO2: Only SEN63C, SEN66, SEN69C
-    bool has_co2 = (this->model_ == Sen6xModel::SEN63C ||
-                    this->model_ == Sen6xModel::SEN66 ||
-                    this->model_ == Sen6xModel::SEN69C);
-    if (this->co2_sensor_ != nullptr && !has_co2) {
-      ESP_LOGW(TAG, "CO2 requires SEN63C/66/69C - disabling sensor");
-      this->co2_sensor_->set_internal(true);
-      this->co2_sensor_ = nullptr;
-    }
+void Sen6xComponent::finish_device_identity_(bool firmware_valid) {
+  this->publish_identity_(firmware_valid);
+  // Cached only when complete and keyed by the real serial
+  if (!firmware_valid || !this->serial_number_valid_ ||
+      this->identity_.product_name[0] == 0)
+    return;
+  this->identity_.version = SEN6X_IDENTITY_VERSION;
+  ESPPreferenceObject preference =
+      global_preferences->make_preference<Sen6xIdentityRecord>(
+          this->preference_hash_ + SEN6X_IDENTITY_PREFERENCE_OFFSET, true);
+  if (preference.save(&this->identity_)) {
+    this->record_flash_write_();
+    ESP_LOGD(TAG, "Device identity cached");
+  }
+}
 
-    // HCHO: Only SEN68, SEN69C
-    bool has_hcho = (this->model_ == Sen6xModel::SEN68 ||
-                     this->model_ == Sen6xModel::SEN69C);
-    if (this->formaldehyde_sensor_ != nullptr && !has_hcho) {
-      ESP_LOGW(TAG, "Formaldehyde requires SEN68/69C - disabling sensor");
-      this->formaldehyde_sensor_->set_disabled_by_default(true);
-      this->formaldehyde_sensor_->set_internal(true); // Hide from HA completely
-      this->formaldehyde_sensor_ = nullptr;
-    }
+void Sen6xComponent::publish_identity_(bool firmware_valid) {
+  ESP_LOGI(TAG, "Serial Number: %s", this->identity_.serial_number);
+  if (firmware_valid) {
+    ESP_LOGI(TAG, "Firmware Version: %u.%u",
+             (unsigned int)this->identity_.firmware_major,
+             (unsigned int)this->identity_.firmware_minor);
+  }
+#ifdef USE_SEN6X_TEXT_SENSOR
+  if (this->product_name_text_sensor_ != nullptr &&
+      this->identity_.product_name[0] != 0) {
+    this->product_name_text_sensor_->publish_state(
+        this->identity_.product_name);
+  }
+  if (this->serial_number_text_sensor_ != nullptr &&
+      this->identity_.serial_number[0] != 0) {
+    this->serial_number_text_sensor_->publish_state(
+        this->identity_.serial_number);
+  }
+  if (this->firmware_version_sensor_ != nullptr && firmware_valid) {
+    char version_str[8]; // "255.255"
+    snprintf(version_str, sizeof(version_str), "%u.%u",
+             (unsigned int)this->identity_.firmware_major,
+             (unsigned int)this->identity_.firmware_minor);
+    this->firmware_version_sensor_->publish_state(version_str);
   }
+#endif
+}
 
-  // Read Serial Number (0xD033)
-  if (this->read_bytes_(SEN6X_CMD_GET_SERIAL_NUMBER, buffer, 32)) {
-    std::string serial;
-    for (int i = 0; i < 32; i++) {
-      if (buffer[i] == 0)
-        break;
-      serial += (char)buffer[i];
-    }
-    ESP_LOGI(TAG, "Serial Number: %s", serial.c_str());
-    if (this->serial_number_text_sensor_ != nullptr) {
-      this->serial_number_text_sensor_->publish_state(serial);
-    }
+void Sen6xComponent::handle_product_name_(const char *product_name) {
+  ESP_LOGI(TAG, "Product Name: %s", product_name);
+
+  // AUTO-DETECT MODEL from product name
+  // This eliminates the need for user to specify model in YAML (model: pins
+  // it at compile time; detection then only verifies it)
+  Sen6xModel detected = Sen6xModel::SEN66;
+  const char *family = std::strstr(product_name, "SEN6");
+  switch (family != nullptr ? family[4] : 0) {
+  case '2':
+    detected = Sen6xModel::SEN62;
+    ESP_LOGI(TAG, "Auto-detected model: SEN62 (PM + RH/T)");
+    break;
+  case '3':
+    detected = Sen6xModel::SEN63C;
+    ESP_LOGI(TAG, "Auto-detected model: SEN63C (PM + RH/T + CO2)");
+    break;
+  case '5':
+    detected = Sen6xModel::SEN65;
+    ESP_LOGI(TAG, "Auto-detected model: SEN65 (PM + RH/T + VOC + NOx)");
+    break;
+  case '6':
+    detected = Sen6xModel::SEN66;
+    ESP_LOGI(TAG, "Auto-detected model: SEN66 (PM + RH/T + VOC + NOx + CO2)");
+    break;
+  case '8':
+    detected = Sen6xModel::SEN68;
+    ESP_LOGI(TAG,
+             "Auto-detected model: SEN68 (PM + RH/T + VOC + NOx + HCHO)");
+    break;
+  case '9':
+    detected = Sen6xModel::SEN69C;
+    ESP_LOGI(
+        TAG,
+        "Auto-detected model: SEN69C (PM + RH/T + VOC + NOx + CO2 + HCHO)");
+    break;
+  default:
+    ESP_LOGW(TAG, "Unknown product '%s', defaulting to SEN66 behavior",
+             product_name);
+    break;
   }
+  this->identity_.model = (uint8_t)detected;
+  this->apply_model_(detected);
+}
 
-  // Read Firmware Version (0xD100) - Optional
-  if (this->firmware_version_sensor_ != nullptr) {
-    uint16_t version_data[1]; // 2 bytes (Major + Minor) + CRC
-    if (this->read_words_(SEN6X_CMD_GET_VERSION, version_data, 1)) {
-      uint8_t major = (version_data[0] >> 8) & 0xFF;
-      uint8_t minor = version_data[0] & 0xFF;
-      char version_str[16];
-      snprintf(version_str, sizeof(version_str), "%d.%d", major, minor);
-      ESP_LOGI(TAG, "Firmware Version: %s", version_str);
-      this->firmware_version_sensor_->publish_state(version_str);
-    }
+void Sen6xComponent::apply_model_(Sen6xModel detected) {
+  if (!this->model_pinned_) {
+    this->model_ = detected;
+  } else if (detected != this->model_) {
+    ESP_LOGW(TAG,
+             "Configured model does not match the detected one - keeping the "
+             "configured decoder. Check 'model:' in YAML!");
+  }
+
+  // ========== AUTO-HIDE UNSUPPORTED SENSORS (Core alignment with SEN5x)
+  // ========== Disable sensors that are not supported by the detected model
+  // This prevents publishing invalid data and cleans up HA entity list
+
+  // VOC: Only SEN65, SEN66, SEN68, SEN69C
+  bool has_voc = (this->model_ == Sen6xModel::SEN65 ||
+                  this->model_ == Sen6xModel::SEN66 ||
+                  this->model_ == Sen6xModel::SEN68 ||
+                  this->model_ == Sen6xModel::SEN69C);
+  if (this->voc_index_sensor_ != nullptr && !has_voc) {
+    ESP_LOGW(TAG, "VOC Index requires SEN65/66/68/69C - disabling sensor");
+    this->voc_index_sensor_->set_internal(true);
+    this->voc_index_sensor_ = nullptr;
+  }
+
+  // NOx: Only SEN65, SEN66, SEN68, SEN69C
+  bool has_nox = has_voc; // Same models as VOC
+  if (this->nox_sensor_ != nullptr && !has_nox) {
+    ESP_LOGW(TAG, "NOx Index requires SEN65/66/68/69C - disabling sensor");
+    this->nox_sensor_->set_internal(true);
+    this->nox_sensor_ = nullptr;
+  }
+
+  // CO2: Only SEN63C, SEN66, SEN69C
+  bool has_co2 = sen6x_model_has_co2(this->model_);
+  if (this->co2_sensor_ != nullptr && !has_co2) {
+    ESP_LOGW(TAG, "CO2 requires SEN63C/66/69C - disabling sensor");
+    this->co2_sensor_->set_internal(true);
+    this->co2_sensor_ = nullptr;
+  }
+
+  // HCHO: Only SEN68, SEN69C
+  bool has_hcho = (this->model_ == Sen6xModel::SEN68 ||
+                   this->model_ == Sen6xModel::SEN69C);
+  if (this->formaldehyde_sensor_ != nullptr && !has_hcho) {
+    ESP_LOGW(TAG, "Formaldehyde requires SEN68/69C - disabling sensor");
+    this->formaldehyde_sensor_->set_disabled_by_default(true);
+    this->formaldehyde_sensor_->set_internal(true); // Hide from HA completely
+    this->formaldehyde_sensor_ = nullptr;
   }
 }
 
 void Sen6xComponent::update() {
+  Sen6xUpdateTimer update_timer(this->diagnostics_);
+
   // One-time diagnostic log (visible in API log, unlike setup logs)
-  static bool first_update = true;
-  if (first_update) {
-    first_update = false;
+  if (this->first_update_) {
+    this->first_update_ = false;
     ESP_LOGI(TAG,
              "Boot diagnostics - Altitude loaded from prefs: %.1f m (NaN means "
              "none)",
              this->pending_altitude_);
   }
 
-  if (this->fan_cleaning_active_state_) {
-    ESP_LOGD(TAG, "Skipping measurement update during fan cleaning.");
+  if (this->boot_phase_ != Sen6xBootPhase::READY) {
+    ESP_LOGD(TAG, "Skipping measurement update (boot sequence in progress).");
     return;
   }
 
-  if (millis() - this->last_fan_cleaning_end_time_ < 10000) {
-    ESP_LOGD(TAG, "Skipping measurement update (settling after cleaning).");
+  // Bus fault: nothing is sent until the backoff probe succeeds
+  if (this->breaker_state_ != Sen6xBreakerState::CLOSED) {
+    ESP_LOGV(TAG, "Skipping measurement update (bus fault backoff).");
     return;
   }
 
-  // ========== VOC BASELINE PERSISTENCE (same as SEN5x official) ==========
-  // Save VOC algorithm state every 3 hours if baseline has changed
-  // significantly
-  if (this->store_baseline_) {
-    this->seconds_since_last_baseline_store_ += 10; // update_interval is ~10s
-
-    if (this->seconds_since_last_baseline_store_ >
-        SHORTEST_BASELINE_STORE_INTERVAL) {
-      // Read current VOC algorithm state from sensor
-      uint8_t cmd[2] = {(uint8_t)(SEN6X_CMD_VOC_ALGORITHM_STATE >> 8),
-                        (uint8_t)(SEN6X_CMD_VOC_ALGORITHM_STATE & 0xFF)};
-
-      if (this->write(cmd, 2) == i2c::ERROR_OK) {
-        delay(20); // Per datasheet execution time
-
-        uint8_t raw_data[12]; // 4 words * (2 bytes + 1 CRC)
-        if (this->read(raw_data, 12) == i2c::ERROR_OK) {
-          // Validate CRCs and extract data
-          bool crc_ok = true;
-          uint16_t states[4];
-          for (int i = 0; i < 4 && crc_ok; i++) {
-            uint8_t expected_crc = sen6x_crc(&raw_data[i * 3], 2);
-            if (raw_data[i * 3 + 2] != expected_crc) {
-              crc_ok = false;
-            } else {
-              states[i] = (raw_data[i * 3] << 8) | raw_data[i * 3 + 1];
-            }
-          }
-
-          if (crc_ok) {
-            int32_t state0 = (states[0] << 16) | states[1];
-            int32_t state1 = (states[2] << 16) | states[3];
-
-            // Check if state changed significantly
-            int32_t diff0 =
-                std::abs(this->voc_baselines_storage_.state0 - state0);
-            int32_t diff1 =
-                std::abs(this->voc_baselines_storage_.state1 - state1);
-
-            if ((uint32_t)diff0 > MAXIMUM_STORAGE_DIFF ||
-                (uint32_t)diff1 > MAXIMUM_STORAGE_DIFF) {
-              this->seconds_since_last_baseline_store_ = 0;
-              this->voc_baselines_storage_.state0 = state0;
-              this->voc_baselines_storage_.state1 = state1;
-
-              if (this->voc_baseline_preference_.save(
-                      &this->voc_baselines_storage_)) {
-                ESP_LOGI(TAG,
-                         "Stored VOC baseline state0: 0x%08X, state1: 0x%08X",
-                         (unsigned int)state0, (unsigned int)state1);
-              } else {
-                ESP_LOGW(TAG, "Could not store VOC baselines");
-              }
-            }
-          }
-        }
-      }
-    }
+  // The poller is stopped while sleeping; this only catches a re-armed one
+  if (this->duty_sleeping_()) {
+    ESP_LOGV(TAG, "Skipping measurement update (duty cycle sleeping).");
+    return;
   }
 
-  this->read_device_status_();
-
-  // Prevent reading data during fan cleaning to avoid PM spikes and I2C
-  // errors (NACKs) - REDUNDANT BUT SAFETY DOUBLE CHECK
   if (this->fan_cleaning_active_state_) {
+    ESP_LOGD(TAG, "Skipping measurement update during fan cleaning.");
+    this->diagnostics_.record_skip(Sen6xSkipReason::FAN_CLEANING);
     return;
   }
 
-  // === DATA READY CHECK (Datasheet 4.8.3) ===
-  // Check if new measurement data is available before reading
-  uint16_t ready_data;
-  if (!this->read_words_(SEN6X_CMD_GET_DATA_READY, &ready_data, 1)) {
-    ESP_LOGW(TAG, "Failed to check data ready status");
+  if (this->idle_window_active_) {
+    ESP_LOGD(TAG, "Skipping measurement update (idle configuration window).");
+    this->diagnostics_.record_skip(Sen6xSkipReason::IDLE_WINDOW);
     return;
   }
-  // Byte 1 contains the ready flag (0x01 = ready, 0x00 = not ready)
-  bool data_ready = (ready_data & 0x00FF) != 0;
-  if (!data_ready) {
-    ESP_LOGD(TAG, "Data not ready yet, skipping measurement");
+
+  if (millis() - this->last_fan_cleaning_end_time_ <
+      SEN6X_FAN_CLEANING_SETTLE_MS) {
+    ESP_LOGD(TAG, "Skipping measurement update (settling after cleaning).");
+    this->diagnostics_.record_skip(Sen6xSkipReason::SETTLING);
     return;
   }
 
-  uint16_t data[10]; // Max 10 words for SEN69C
-  uint8_t word_count = this->get_measurement_word_count_();
+  // ========== VOC BASELINE PERSISTENCE (same as SEN5x official) ==========
+  if (this->store_baseline_)
+    this->check_voc_baseline_();
 
-  if (!this->read_measurement_data_(data, word_count)) {
-    ESP_LOGW(TAG, "Failed to read data");
+  if (this->measurement_cycle_active_) {
+    ESP_LOGD(TAG, "Previous measurement cycle still in progress, skipping");
+    this->diagnostics_.record_skip(Sen6xSkipReason::CYCLE_BUSY);
     return;
   }
+  this->measurement_cycle_active_ = true;
 
-  // === INVALID DATA DETECTION (Datasheet 4.8.4-4.8.9) ===
-  // When sensor hasn't stabilized, it returns 0xFFFF (uint16) or 0x7FFF (int16)
-  // Common data layout (first 6 words): PM1.0[0], PM2.5[1], PM4.0[2],
-  // PM10.0[3], RH[4], T[5] Remaining words depend on model:
-  //   SEN62: (no more)
-  //   SEN63C: CO2[6]
-  //   SEN65: VOC[6], NOx[7]
-  //   SEN66: VOC[6], NOx[7], CO2[8]
-  //   SEN68: VOC[6], NOx[7], HCHO[8]
-  //   SEN69C: VOC[6], NOx[7], HCHO[8], CO2[9]
-  bool has_invalid_data = false;
-
-  // Check PM sensors (uint16 - 0xFFFF indicates invalid)
-  if (data[0] == 0xFFFF || data[1] == 0xFFFF || data[2] == 0xFFFF ||
-      data[3] == 0xFFFF) {
-    ESP_LOGD(TAG, "PM data invalid (0xFFFF), waiting for stabilization");
-    has_invalid_data = true;
-  }
-
-  // Check RH/T/VOC/NOx (int16 - 0x7FFF indicates invalid)
-  if (data[4] == 0x7FFF || data[5] == 0x7FFF || data[6] == 0x7FFF ||
-      data[7] == 0x7FFF) {
-    ESP_LOGD(TAG,
-             "RH/T/VOC/NOx data invalid (0x7FFF), waiting for stabilization");
-    has_invalid_data = true;
+#ifdef USE_SEN6X_SENSOR_TASK
+  if (this->sensor_task_ != nullptr) {
+    this->request_task_cycle_();
+    return;
   }
+#endif
 
-  // Check CO2 (uint16 - 0xFFFF indicates invalid)
-  if (data[8] == 0xFFFF) {
-    ESP_LOGD(TAG, "CO2 data invalid (0xFFFF), waiting for stabilization");
-    has_invalid_data = true;
-  }
+  // Each step is queued and runs from loop(); update() returns immediately
+  // and values are published once the frame arrives.
+  // Every group runs at its own decimation of the update interval.
+  if (this->status_poll_due_())
+    this->read_device_status_();
+  if (this->poll_group_due_(Sen6xPollGroup::READBACK))
+    this->read_device_configuration_();
+  this->cycle_reads_nc_ =
+      this->poll_group_due_(Sen6xPollGroup::NUMBER_CONCENTRATION);
 
-  if (has_invalid_data) {
+  if (!this->poll_group_due_(Sen6xPollGroup::FRAME)) {
+    // Secondary reads only; NC ends the cycle when due
+    this->read_number_concentration_();
     return;
   }
 
-  // Parse and publish
-  // Scaling factors based on Sensirion datasheet/driver logic
-  // Mass Concentration: / 10.0
-  if (this->pm_1_0_sensor_ != nullptr)
-    this->pm_1_0_sensor_->publish_state(data[0] / 10.0f);
-  if (this->pm_2_5_sensor_ != nullptr)
-    this->pm_2_5_sensor_->publish_state(data[1] / 10.0f);
-  if (this->pm_4_0_sensor_ != nullptr)
-    this->pm_4_0_sensor_->publish_state(data[2] / 10.0f);
-  if (this->pm_10_0_sensor_ != nullptr)
-    this->pm_10_0_sensor_->publish_state(data[3] / 10.0f);
-
-  // RH: / 100.0 (int16)
-  float humidity = (int16_t)data[4] / 100.0f;
-  if (this->humidity_sensor_ != nullptr)
-    this->humidity_sensor_->publish_state(humidity);
-
-  // T: / 200.0 (Sensirion Standard for SEN5x/6x)
-  float temperature = (int16_t)data[5] / 200.0f;
-  if (this->temperature_sensor_ != nullptr)
-    this->temperature_sensor_->publish_state(temperature);
-
-  // VOC/NOx: / 10.0
-  float voc_index = 0.0f;
-  if (this->voc_index_sensor_ != nullptr) {
-    voc_index = (int16_t)data[6] / 10.0f;
-    this->voc_index_sensor_->publish_state(voc_index);
+  if (this->polling_mode_ == Sen6xPollingMode::PHASE_LOCKED) {
+    this->schedule_phase_locked_read_();
+    return;
   }
 
-  // Calculated Metrics (WELL/RESET) based on VOC Index
-  if (voc_index > 0.0f) {
-    if (this->well_tvoc_sensor_ != nullptr) {
-      float well_tvoc = EnvironmentalPhysics::calculate_well_tvoc(voc_index);
-      this->well_tvoc_sensor_->publish_state(well_tvoc);
-    }
-    if (this->reset_tvoc_sensor_ != nullptr) {
-      float reset_tvoc = EnvironmentalPhysics::calculate_reset_tvoc(voc_index);
-      this->reset_tvoc_sensor_->publish_state(reset_tvoc);
-    }
-  }
-  // TVOC Ethanol - Only publish if VOC Index is valid
-  if (this->tvoc_ethanol_sensor_ != nullptr && voc_index > 0.0f) {
-    float ethanol = EnvironmentalPhysics::calculate_ethanol_tvoc(voc_index);
-    this->tvoc_ethanol_sensor_->publish_state(ethanol);
-  }
+  // === DATA READY CHECK (Datasheet 4.8.3) ===
+  // Check if new measurement data is available before reading
+  this->queue_read_(SEN6X_CMD_GET_DATA_READY, 1,
+                    [this](bool ok, const uint16_t *data, uint8_t words) {
+                      if (!ok) {
+                        ESP_LOGW(TAG, "Failed to check data ready status");
+                        this->end_measurement_cycle_();
+                        return;
+                      }
+                      // Byte 1 contains the ready flag (0x01 = ready)
+                      bool data_ready = (data[0] & 0x00FF) != 0;
+                      if (!data_ready) {
+                        ESP_LOGD(TAG,
+                                 "Data not ready yet, skipping measurement");
+                        this->diagnostics_.record_skip(
+                            Sen6xSkipReason::DATA_NOT_READY);
+                        this->end_measurement_cycle_();
+                        return;
+                      }
+                      this->read_measurement_data_();
+                    });
+}
 
-  if (this->nox_sensor_ != nullptr)
-    this->nox_sensor_->publish_state((int16_t)data[7] / 10.0f);
+// ========== PHASE-LOCKED POLLING ==========
+// The sensor produces a new sample every ~1s. Once the data-ready edge has
+// been located, reads are scheduled just after the predicted edge and the
+// data-ready probe is skipped. The phase (and the sensor/MCU clock ratio) is
+// re-measured every SEN6X_PHASE_RELOCK_CYCLES reads and after every restart.
 
-  // CO2: Position varies by model (Datasheet v0.92)
-  //   SEN63C: data[6]
-  //   SEN66: data[8]
-  //   SEN69C: data[9] (after HCHO at data[8])
-  float co2 = 0.0f;
-  if (this->co2_sensor_ != nullptr) {
-    switch (this->model_) {
-    case Sen6xModel::SEN63C:
-      co2 = (float)data[6];
-      break;
-    case Sen6xModel::SEN66:
-      co2 = (float)data[8];
-      break;
-    case Sen6xModel::SEN69C:
-      co2 = (float)data[9];
-      break;
-    default:
-      co2 = 0.0f; // Model doesn't have CO2
-      break;
-    }
-    if (co2 > 0.0f) {
-      this->co2_sensor_->publish_state(co2);
-    }
-  }
+void Sen6xComponent::reset_phase_lock_() {
+  this->phase_locked_ = false;
+  this->phase_anchor_valid_ = false;
+  this->phase_period_ms_ = SEN6X_MEASUREMENT_PERIOD_MS;
+}
 
-  // HCHO (Formaldehyde): data[8] for SEN68/SEN69C (Datasheet v0.92)
-  // Scaled by /10 for ppb
-  float hcho = 0.0f;
-  if (this->formaldehyde_sensor_ != nullptr) {
-    if (this->model_ == Sen6xModel::SEN68 ||
-        this->model_ == Sen6xModel::SEN69C) {
-      hcho = data[8] / 10.0f; // HCHO [ppb] = value / 10
-      if (hcho > 0.0f) {
-        this->formaldehyde_sensor_->publish_state(hcho);
-      }
+void Sen6xComponent::schedule_phase_locked_read_() {
+  uint32_t now = millis();
+
+  if (!this->phase_locked_ ||
+      this->phase_reads_since_lock_ >= SEN6X_PHASE_RELOCK_CYCLES) {
+    // (Re)acquire: start probing shortly before the predicted edge (if any)
+    this->phase_locked_ = false;
+    this->phase_seen_not_ready_ = false;
+    this->phase_frame_pending_ = true;
+    this->phase_probe_count_ = 0;
+    uint32_t wait = 0;
+    if (this->phase_anchor_valid_) {
+      float since_edge = std::fmod((float)(now - this->phase_anchor_ms_),
+                                   this->phase_period_ms_);
+      float until_edge = this->phase_period_ms_ - since_edge;
+      if (until_edge > 2 * SEN6X_PHASE_PROBE_INTERVAL_MS)
+        wait = (uint32_t)(until_edge - 2 * SEN6X_PHASE_PROBE_INTERVAL_MS);
     }
+    this->set_timeout("phase_probe", wait,
+                      [this]() { this->probe_data_ready_phase_(); });
+    return;
   }
 
-  // ========== NUMBER CONCENTRATION (particles/cm³) ==========
-  // Optional: Read 0x0316 only if at least one NC sensor is configured
-  if (this->nc_0_5_sensor_ != nullptr || this->nc_1_0_sensor_ != nullptr ||
-      this->nc_2_5_sensor_ != nullptr || this->nc_4_0_sensor_ != nullptr ||
-      this->nc_10_0_sensor_ != nullptr) {
-    uint16_t nc_data[5]; // 5 uint16 values + CRCs
-    if (this->read_words_(SEN6X_CMD_NUMBER_CONCENTRATION, nc_data, 5)) {
-      // All values scaled x10 per datasheet
-      if (this->nc_0_5_sensor_ != nullptr && nc_data[0] != 0xFFFF) {
-        this->nc_0_5_sensor_->publish_state((float)nc_data[0] / 10.0f);
-      }
-      if (this->nc_1_0_sensor_ != nullptr && nc_data[1] != 0xFFFF) {
-        this->nc_1_0_sensor_->publish_state((float)nc_data[1] / 10.0f);
-      }
-      if (this->nc_2_5_sensor_ != nullptr && nc_data[2] != 0xFFFF) {
-        this->nc_2_5_sensor_->publish_state((float)nc_data[2] / 10.0f);
-      }
-      if (this->nc_4_0_sensor_ != nullptr && nc_data[3] != 0xFFFF) {
-        this->nc_4_0_sensor_->publish_state((float)nc_data[3] / 10.0f);
-      }
-      if (this->nc_10_0_sensor_ != nullptr && nc_data[4] != 0xFFFF) {
-        this->nc_10_0_sensor_->publish_state((float)nc_data[4] / 10.0f);
-      }
-    }
+  // Locked: advance the anchor to the most recent edge (keeps the float math
+  // small) and read just after the next one
+  float elapsed = (float)(now - this->phase_anchor_ms_);
+  uint32_t cycles = (uint32_t)(elapsed / this->phase_period_ms_);
+  this->phase_anchor_ms_ += (uint32_t)(cycles * this->phase_period_ms_);
+  float since_edge = (float)(now - this->phase_anchor_ms_);
+  uint32_t wait = (uint32_t)(this->phase_period_ms_ - since_edge) +
+                  SEN6X_PHASE_MARGIN_MS;
+  if (since_edge < SEN6X_PHASE_MARGIN_MS) {
+    // Current sample was published just now - read it after the margin
+    wait = SEN6X_PHASE_MARGIN_MS - (uint32_t)since_edge;
   }
+
+  this->phase_reads_since_lock_++;
+  this->set_timeout("phase_read", wait,
+                    [this]() { this->read_measurement_data_(); });
 }
 
-void Sen6xComponent::read_device_status_() {
-  uint16_t status_words[2]; // Device status is 2 words (4 bytes)
-  if (!this->read_words_(SEN6X_CMD_GET_STATUS, status_words, 2)) {
-    ESP_LOGW(TAG, "Failed to read device status");
+void Sen6xComponent::probe_data_ready_phase_() {
+  if (this->fan_cleaning_active_state_ || this->idle_window_active_) {
+    if (this->phase_frame_pending_)
+      this->end_measurement_cycle_();
+    this->phase_frame_pending_ = false;
     return;
   }
 
-  uint32_t device_status = ((uint32_t)status_words[0] << 16) | status_words[1];
-  ESP_LOGD(TAG, "Device Status: 0x%08X", device_status);
-
-  // Publish Status Hex
-  if (this->status_text_sensor_ != nullptr) {
-    char hex_value[11];
-    sprintf(hex_value, "0x%08X", device_status);
-    this->status_text_sensor_->publish_state(hex_value);
-  }
+  this->queue_read_(
+      SEN6X_CMD_GET_DATA_READY, 1,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to check data ready status");
+          if (this->phase_frame_pending_)
+            this->end_measurement_cycle_();
+          this->phase_frame_pending_ = false;
+          return;
+        }
 
-  // Publish Binary Sensors
-  // Bit definitions based on Sensirion SEN6x datasheet/driver
-  if (this->fan_error_binary_sensor_ != nullptr)
-    this->fan_error_binary_sensor_->publish_state((device_status & (1 << 21)) !=
-                                                  0);
+        // Byte 1 contains the ready flag (0x01 = ready)
+        bool data_ready = (data[0] & 0x00FF) != 0;
+        if (data_ready && this->phase_seen_not_ready_) {
+          this->on_data_ready_edge_(millis());
+          return;
+        }
 
-  if (this->rht_error_binary_sensor_ != nullptr)
-    this->rht_error_binary_sensor_->publish_state((device_status & (1 << 20)) !=
-                                                  0);
+        if (data_ready) {
+          // Flag was already set (unknown age). Reading the frame clears it,
+          // so the next ready flag seen is a genuine edge.
+          this->phase_seen_not_ready_ = true;
+          if (this->phase_frame_pending_) {
+            this->phase_frame_pending_ = false;
+            this->read_measurement_data_();
+          }
+        } else {
+          this->phase_seen_not_ready_ = true;
+        }
 
-  if (this->gas_error_binary_sensor_ != nullptr)
-    this->gas_error_binary_sensor_->publish_state((device_status & (1 << 19)) !=
-                                                  0);
+        if (++this->phase_probe_count_ >= SEN6X_PHASE_MAX_PROBES) {
+          ESP_LOGW(TAG, "Data-ready edge not found, retrying next update");
+          if (this->phase_frame_pending_)
+            this->end_measurement_cycle_();
+          this->phase_frame_pending_ = false;
+          return;
+        }
+        this->set_timeout("phase_probe", SEN6X_PHASE_PROBE_INTERVAL_MS,
+                          [this]() { this->probe_data_ready_phase_(); });
+      });
+}
 
-  if (this->pm_error_binary_sensor_ != nullptr)
-    this->pm_error_binary_sensor_->publish_state((device_status & (1 << 18)) !=
-                                                 0);
+void Sen6xComponent::on_data_ready_edge_(uint32_t now) {
+  // 'now' is an upper bound of the edge (probe resolution + execution time).
+  // Refine the period from the error accumulated since the last lock.
+  if (this->phase_anchor_valid_) {
+    float elapsed = (float)(now - this->phase_origin_ms_);
+    float cycles = std::round(elapsed / this->phase_period_ms_);
+    if (cycles >= SEN6X_PHASE_RELOCK_CYCLES / 3) {
+      float period = elapsed / cycles;
+      // Sensor oscillator tolerance is a few percent at most
+      if (std::fabs(period - SEN6X_MEASUREMENT_PERIOD_MS) <
+          SEN6X_MEASUREMENT_PERIOD_MS * 0.05f)
+        this->phase_period_ms_ = period;
+    }
+  }
 
-  // LDIR/Laser Error (Bit 17 or 12?)
-  // Common driver maps Bit 17 to Laser Error
-  if (this->laser_error_binary_sensor_ != nullptr)
-    this->laser_error_binary_sensor_->publish_state(
-        (device_status & (1 << 17)) != 0);
+  this->phase_anchor_ms_ = now;
+  this->phase_origin_ms_ = now;
+  this->phase_anchor_valid_ = true;
+  this->phase_locked_ = true;
+  this->phase_reads_since_lock_ = 0;
+  ESP_LOGD(TAG, "Phase-locked to data-ready edge (period %.1f ms)",
+           this->phase_period_ms_);
 
-  // Fan Warning (Bit 21 is technically Fan Speed Warning)
-  if (this->fan_warning_binary_sensor_ != nullptr)
-    this->fan_warning_binary_sensor_->publish_state(
-        (device_status & (1 << 21)) != 0);
+  if (this->phase_frame_pending_) {
+    this->phase_frame_pending_ = false;
+    this->read_measurement_data_();
+  }
+}
 
-  // Fan Cleaning Active
-  // Datasheet does not define a dedicated status bit for this.
-  // We use our internal software state.
-  if (this->fan_cleaning_active_binary_sensor_ != nullptr)
-    this->fan_cleaning_active_binary_sensor_->publish_state(
-        this->fan_cleaning_active_state_);
+// Saves the VOC algorithm state at most every min_interval (wall clock, not
+// update cycles) and only if it moved by more than max_diff
+void Sen6xComponent::check_voc_baseline_() {
+  // VOC algorithm state exists on SEN65/66/68/69C only
+  if (this->model_ == Sen6xModel::SEN62 || this->model_ == Sen6xModel::SEN63C)
+    return;
+  uint32_t now = millis();
+  if (now - this->last_baseline_store_ms_ < this->baseline_store_interval_ms_ ||
+      now - this->last_baseline_check_ms_ < SEN6X_BASELINE_CHECK_INTERVAL_MS)
+    return;
+  this->last_baseline_check_ms_ = now;
+
+  this->queue_read_(
+      SEN6X_CMD_VOC_ALGORITHM_STATE, 4,
+      [this](bool ok, const uint16_t *states, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to read VOC algorithm state");
+          return;
+        }
+        int32_t state0 = (int32_t)(((uint32_t)states[0] << 16) | states[1]);
+        int32_t state1 = (int32_t)(((uint32_t)states[2] << 16) | states[3]);
+
+        // Check if state changed significantly
+        const Sen6xBaselines &stored = this->config_.voc_baselines;
+        int64_t diff0 = std::llabs((int64_t)stored.state0 - state0);
+        int64_t diff1 = std::llabs((int64_t)stored.state1 - state1);
+        if (diff0 <= this->baseline_store_diff_ &&
+            diff1 <= this->baseline_store_diff_) {
+          ESP_LOGV(TAG, "VOC baseline unchanged, not stored");
+          return;
+        }
 
-  // Log warnings for debugging (preserved)
-  if (device_status & (1 << 21))
-    ESP_LOGW(TAG, "Status: Fan Speed Warning");
-  if (device_status & (1 << 19))
-    ESP_LOGW(TAG, "Status: Gas Error");
-  if (device_status & (1 << 18))
-    ESP_LOGW(TAG, "Status: PM Error");
+        this->last_baseline_store_ms_ = millis();
+        this->update_config_(this->config_.voc_baselines,
+                             Sen6xBaselines{state0, state1});
+        ESP_LOGI(TAG, "Stored VOC baseline state0: 0x%08X, state1: 0x%08X",
+                 (unsigned int)state0, (unsigned int)state1);
+      });
 }
 
-void Sen6xComponent::read_device_configuration_() {
-  uint16_t data;
-
-  // Read Ambient Pressure (0x6720)
-  if (this->read_words_(SEN6X_CMD_GET_AMBIENT_PRESSURE, &data, 1)) {
-    // Scale checks needed. Assuming int16 raw hPa for now based on common
-    // drivers.
-    int16_t pressure = (int16_t)data;
-    ESP_LOGD(TAG, "Ambient Pressure: %d", pressure);
-    if (this->ambient_pressure_sensor_ != nullptr)
-      this->ambient_pressure_sensor_->publish_state(pressure); // Scaling 1.0
-
-    // Sync Number Component
-    if (this->ambient_pressure_compensation_number_ != nullptr) {
-      this->ambient_pressure_compensation_number_->publish_state(pressure);
-    }
+void Sen6xComponent::read_measurement_data_() {
+  // Prevent reading data during fan cleaning (or an idle configuration
+  // window) to avoid PM spikes and I2C errors (NACKs) - REDUNDANT BUT SAFETY
+  // DOUBLE CHECK
+  if (this->fan_cleaning_active_state_ || this->idle_window_active_) {
+    this->diagnostics_.record_skip(this->fan_cleaning_active_state_
+                                       ? Sen6xSkipReason::FAN_CLEANING
+                                       : Sen6xSkipReason::IDLE_WINDOW);
+    this->end_measurement_cycle_();
+    return;
   }
 
-  // Read Sensor Altitude (0x6736)
-  if (this->read_words_(SEN6X_CMD_GET_SENSOR_ALTITUDE, &data, 1)) {
-    int16_t altitude = (int16_t)data;
-    ESP_LOGD(TAG, "Sensor Altitude read from device: %d", altitude);
-
-    // SEN6x doesn't persist altitude internally - it's volatile.
-    // After boot, the sensor reports 0 even though we wrote a value in
-    // setup(). Use the NVS value for both sensor and number if we restored
-    // it.
-    if (this->altitude_restored_ && !std::isnan(this->pending_altitude_)) {
-      // We restored from NVS - use that value (more accurate than sensor's 0)
-      float nvs_altitude = this->pending_altitude_;
-      if (this->sensor_altitude_sensor_ != nullptr)
-        this->sensor_altitude_sensor_->publish_state(nvs_altitude);
-      // Number already published in setup(), skip here
-    } else {
-      // No NVS value - use what sensor reports
-      if (this->sensor_altitude_sensor_ != nullptr)
-        this->sensor_altitude_sensor_->publish_state(altitude);
-      if (this->altitude_compensation_number_ != nullptr)
-        this->altitude_compensation_number_->publish_state(altitude);
-    }
-  }
+  // Each SEN6x model has its own I2C command (Datasheet v0.92 Table 26)
+  uint16_t command = this->get_measurement_command_();
+  this->queue_read_(command, this->get_measurement_word_count_(),
+                    [this, command](bool ok, const uint16_t *data,
+                                    uint8_t words) {
+                      if (!ok) {
+                        ESP_LOGW(TAG, "Failed to read data");
+                        this->end_measurement_cycle_();
+                        return;
+                      }
+                      this->capture_(command, data, words);
+                      this->handle_measurement_data_(data, words);
+                    });
 }
 
-bool Sen6xComponent::write_command_(uint16_t command) {
-  uint8_t data[2];
-  data[0] = (command >> 8) & 0xFF;
-  data[1] = command & 0xFF;
-  return this->write(data, 2) == i2c::ERROR_OK;
-}
+void Sen6xComponent::handle_measurement_data_(const uint16_t *data,
+                                              uint8_t words) {
+  // Parse and publish with the model's compile-time frame layout
+#ifdef SEN6X_PINNED_MODEL
+  this->decode_frame_<SEN6X_PINNED_MODEL>(data, words);
+#else
+  switch (this->model_) {
+  case Sen6xModel::SEN62:
+    this->decode_frame_<Sen6xModel::SEN62>(data, words);
+    break;
+  case Sen6xModel::SEN63C:
+    this->decode_frame_<Sen6xModel::SEN63C>(data, words);
+    break;
+  case Sen6xModel::SEN65:
+    this->decode_frame_<Sen6xModel::SEN65>(data, words);
+    break;
+  case Sen6xModel::SEN68:
+    this->decode_frame_<Sen6xModel::SEN68>(data, words);
+    break;
+  case Sen6xModel::SEN69C:
+    this->decode_frame_<Sen6xModel::SEN69C>(data, words);
+    break;
+  case Sen6xModel::SEN66:
+  default:
+    this->decode_frame_<Sen6xModel::SEN66>(data, words);
+    break;
+  }
+#endif
 
-bool Sen6xComponent::write_command_with_data_(uint16_t command, uint16_t data) {
-  uint8_t buffer[5];
-  buffer[0] = (command >> 8) & 0xFF;
-  buffer[1] = command & 0xFF;
-  buffer[2] = (data >> 8) & 0xFF;
-  buffer[3] = data & 0xFF;
+  // Number Concentration is chained after the frame (ends the cycle)
+  this->read_number_concentration_();
+}
+
+template<Sen6xModel M>
+void Sen6xComponent::decode_frame_(const uint16_t *data, uint8_t words) {
+  using Traits = Sen6xModelTraits<M>;
+
+  // The frame was requested for the model at queue time; a model change in
+  // between (auto-detection at boot) must not index past the response
+  if (words < Traits::WORDS) {
+    ESP_LOGW(TAG, "Short measurement frame (%u of %u words), skipped",
+             words, Traits::WORDS);
+    this->diagnostics_.record_skip(Sen6xSkipReason::INVALID_FRAME);
+    return;
+  }
+  this->telemetry_.begin();
+
+  // === INVALID DATA DETECTION (Datasheet 4.8.4-4.8.9) ===
+  // While a channel hasn't stabilized it reads 0xFFFF (uint16) or 0x7FFF
+  // (int16); only that channel is skipped, the rest of the frame publishes.
+  // Values are buffered as raw words when aggregating.
+  // With duty cycling a valid channel still waits for its warm-up; the
+  // frame counts as stable once every consumed channel is published.
+  uint16_t invalid_words = 0;
+  bool stable = true;
+  for (const Sen6xFrameField &field : Traits::FIELDS) {
+    uint16_t raw = data[field.word];
+    bool consumed = this->channel_sensor_(field.channel) != nullptr ||
+                    this->telemetry_.is_enabled();
+    if (!sen6x_word_valid(field.channel, raw)) {
+      invalid_words |= 1U << field.word;
+      if (consumed)
+        stable = false;
+      continue;
+    }
+    if (!this->duty_channel_warm_(field.channel)) {
+      if (consumed)
+        stable = false;
+      continue;
+    }
+    // Frame channels share their index with the telemetry slot
+    this->telemetry_.set_word(
+        static_cast<Sen6xTelemetrySlot>(field.channel), raw);
+    this->check_burst_triggers_(field.channel, raw);
+    if (field.channel == Sen6xChannel::PM_2_5 &&
+        !std::isnan(this->quiet_max_pm_stddev_))
+      this->quiet_detector_.feed(raw / 10.0f); // Scaled x10
+    if (field.channel == Sen6xChannel::CO2)
+      this->co2_stability_.add(raw); // ppm, unscaled
+    else if (field.channel == Sen6xChannel::HUMIDITY)
+      this->ambient_humidity_ = (int16_t)raw / 100.0f; // Scaled x100
+    if (this->channel_sensor_(field.channel) == nullptr)
+      continue;
+    this->emit_channel_(field.channel, raw);
+
+    // Calculated Metrics (WELL/RESET/Ethanol) follow the published VOC
+    // Index; when aggregating they are the window mean of the per-sample
+    // estimates
+    if (field.channel == Sen6xChannel::VOC_INDEX &&
+        !this->aggregation_enabled_())
+      this->publish_tvoc_estimates_(
+          EnvironmentalPhysics::derive((int16_t)raw));
+  }
+
+  if (invalid_words != 0) {
+    ESP_LOGD(TAG,
+             "Invalid frame words (mask 0x%03X), waiting for stabilization",
+             invalid_words);
+    this->diagnostics_.record_skip(Sen6xSkipReason::INVALID_FRAME);
+  }
+  if (stable)
+    this->duty_frame_stable_ = true;
+}
+
+void Sen6xComponent::read_number_concentration_() {
+  // ========== NUMBER CONCENTRATION (particles/cm³) ==========
+  // Optional: Read 0x0316 only if at least one NC sensor is configured and
+  // the NC group is due this cycle
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+  if (!this->cycle_reads_nc_ || !this->number_concentration_wanted_()) {
+    this->end_measurement_cycle_();
+    return;
+  }
+
+  this->queue_read_(
+      SEN6X_CMD_NUMBER_CONCENTRATION, 5,
+      [this](bool ok, const uint16_t *nc_data, uint8_t words) {
+        if (ok) {
+          this->capture_(SEN6X_CMD_NUMBER_CONCENTRATION, nc_data, words);
+          this->handle_number_concentration_(nc_data, words);
+        }
+        this->end_measurement_cycle_();
+      });
+#else
+  this->end_measurement_cycle_();
+#endif
+}
 
-  // Generate CRC for the data word
-  uint8_t crc_data[2] = {buffer[2], buffer[3]};
-  buffer[4] = sen6x_crc(crc_data, 2);
+bool Sen6xComponent::number_concentration_wanted_() const {
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+  return this->nc_0_5_sensor_ != nullptr || this->nc_1_0_sensor_ != nullptr ||
+         this->nc_2_5_sensor_ != nullptr || this->nc_4_0_sensor_ != nullptr ||
+         this->nc_10_0_sensor_ != nullptr || this->telemetry_.is_enabled();
+#else
+  return false;
+#endif
+}
 
-  return this->write(buffer, 5) == i2c::ERROR_OK;
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+void Sen6xComponent::handle_number_concentration_(const uint16_t *data,
+                                                  uint8_t words) {
+  // All values scaled x10 per datasheet, NC_0_5..NC_10_0 in order
+  for (uint8_t i = 0; i < words && i < 5; i++) {
+    Sen6xChannel channel = static_cast<Sen6xChannel>(
+        static_cast<uint8_t>(Sen6xChannel::NC_0_5) + i);
+    if (!sen6x_word_valid(channel, data[i]) ||
+        !this->duty_channel_warm_(channel))
+      continue;
+    this->telemetry_.set_word(
+        static_cast<Sen6xTelemetrySlot>(
+            static_cast<uint8_t>(Sen6xTelemetrySlot::NC_0_5) + i),
+        data[i]);
+    if (this->channel_sensor_(channel) != nullptr)
+      this->emit_channel_(channel, data[i]);
+  }
 }
+#endif
 
-bool Sen6xComponent::start_measurement_() {
-  return this->write_command_(SEN6X_CMD_START_MEASUREMENT);
+void Sen6xComponent::publish_telemetry_() {
+  this->telemetry_.publish(
+      static_cast<uint8_t>(this->model_), millis(),
+      this->device_status_valid_ ? this->last_device_status_ : 0);
 }
 
-void Sen6xComponent::start_fan_cleaning_() {
-  ESP_LOGD(TAG, "Stopping measurement to start fan cleaning...");
-  if (!this->write_command_(SEN6X_CMD_STOP_MEASUREMENT)) {
-    ESP_LOGW(TAG, "Failed to stop measurement!");
+// ========== RAW CAPTURE / REPLAY ==========
+
+void Sen6xComponent::dump_capture() {
+#ifdef USE_SEN6X_CAPTURE
+  // One line per record so the log can be piped straight into sen6x_replay
+  ESP_LOGI(TAG, "SEN6XCAP BEGIN records=%u dropped=%u",
+           (unsigned int)this->capture_ring_.get_record_count(),
+           (unsigned int)this->capture_ring_.get_dropped_count());
+  this->capture_ring_.for_each([](uint32_t timestamp_ms, uint16_t command,
+                                  const uint16_t *words, uint8_t count) {
+    char line[SEN6X_CAPTURE_MAX_WORDS * 5 + 1];
+    for (uint8_t i = 0; i < count; i++)
+      snprintf(line + i * 5, 6, " %04X", words[i]);
+    line[count * 5] = '\0';
+    ESP_LOGI(TAG, "SEN6XCAP %u %04X%s", (unsigned int)timestamp_ms, command,
+             line);
+  });
+  ESP_LOGI(TAG, "SEN6XCAP END");
+#else
+  ESP_LOGW(TAG, "Raw capture not enabled (set 'capture:' in YAML)");
+#endif
+}
+
+void Sen6xComponent::replay_response(uint16_t command, const uint16_t *data,
+                                     uint8_t words) {
+  switch (command) {
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+  case SEN6X_CMD_NUMBER_CONCENTRATION:
+    this->handle_number_concentration_(data, words);
+    return;
+#endif
+  case SEN6X_CMD_GET_STATUS:
+    if (words >= 2)
+      this->handle_device_status_(((uint32_t)data[0] << 16) | data[1]);
+    return;
+#ifdef SEN6X_PINNED_MODEL
+  case Sen6xModelTraits<SEN6X_PINNED_MODEL>::READ_COMMAND:
+    this->decode_frame_<SEN6X_PINNED_MODEL>(data, words);
+    return;
+#else
+  // The frame layout follows the recorded command, not the detected model
+  case Sen6xModelTraits<Sen6xModel::SEN62>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN62>(data, words);
+    return;
+  case Sen6xModelTraits<Sen6xModel::SEN63C>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN63C>(data, words);
+    return;
+  case Sen6xModelTraits<Sen6xModel::SEN65>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN65>(data, words);
+    return;
+  case Sen6xModelTraits<Sen6xModel::SEN66>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN66>(data, words);
+    return;
+  case Sen6xModelTraits<Sen6xModel::SEN68>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN68>(data, words);
+    return;
+  case Sen6xModelTraits<Sen6xModel::SEN69C>::READ_COMMAND:
+    this->decode_frame_<Sen6xModel::SEN69C>(data, words);
+    return;
+#endif
+  default:
+    ESP_LOGW(TAG, "Replay: unsupported command 0x%04X", command);
+    return;
+  }
+}
+
+// ========== CHANNEL OUTPUT / WINDOWED AGGREGATION ==========
+
+esphome::sensor::Sensor *Sen6xComponent::channel_sensor_(Sen6xChannel channel) {
+  switch (channel) {
+  case Sen6xChannel::PM_1_0:
+    return this->pm_1_0_sensor_;
+  case Sen6xChannel::PM_2_5:
+    return this->pm_2_5_sensor_;
+  case Sen6xChannel::PM_4_0:
+    return this->pm_4_0_sensor_;
+  case Sen6xChannel::PM_10_0:
+    return this->pm_10_0_sensor_;
+  case Sen6xChannel::HUMIDITY:
+    return this->humidity_sensor_;
+  case Sen6xChannel::TEMPERATURE:
+    return this->temperature_sensor_;
+  case Sen6xChannel::VOC_INDEX:
+    return this->voc_index_sensor_;
+  case Sen6xChannel::NOX_INDEX:
+    return this->nox_sensor_;
+  case Sen6xChannel::CO2:
+    return this->co2_sensor_;
+  case Sen6xChannel::FORMALDEHYDE:
+    return this->formaldehyde_sensor_;
+#ifdef USE_SEN6X_TVOC
+  case Sen6xChannel::TVOC_WELL:
+    return this->well_tvoc_sensor_;
+  case Sen6xChannel::TVOC_RESET:
+    return this->reset_tvoc_sensor_;
+  case Sen6xChannel::TVOC_ETHANOL:
+    return this->tvoc_ethanol_sensor_;
+#endif
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+  case Sen6xChannel::NC_0_5:
+    return this->nc_0_5_sensor_;
+  case Sen6xChannel::NC_1_0:
+    return this->nc_1_0_sensor_;
+  case Sen6xChannel::NC_2_5:
+    return this->nc_2_5_sensor_;
+  case Sen6xChannel::NC_4_0:
+    return this->nc_4_0_sensor_;
+  case Sen6xChannel::NC_10_0:
+    return this->nc_10_0_sensor_;
+#endif
+  default:
+    return nullptr;
+  }
+}
+
+// Raw word -> engineering units (Sensirion scaling per channel)
+static float sen6x_channel_value(Sen6xChannel channel, float raw) {
+  return raw / SEN6X_CHANNEL_SCALES[static_cast<uint8_t>(channel)].divisor;
+}
+
+void Sen6xComponent::emit_channel_(Sen6xChannel channel, uint16_t raw) {
+  uint8_t index = static_cast<uint8_t>(channel);
+  float value = sen6x_channel_value(
+      channel, SEN6X_CHANNEL_SCALES[index].is_signed ? (float)(int16_t)raw
+                                                     : (float)raw);
+  this->feed_rolling_average_(channel, value);
+  if (this->aggregation_enabled_()) {
+    this->sample_rings_[index].push(raw);
     return;
   }
+  this->publish_channel_(channel, this->channel_sensor_(channel), value);
+}
+
+void Sen6xComponent::publish_tvoc_estimates_(
+    const Sen6xDerivedMetrics &metrics) {
+#ifdef USE_SEN6X_TVOC
+  // Calculated Metrics (WELL/RESET/Ethanol), only with a valid VOC Index
+  if (metrics.count == 0)
+    return;
+  if (this->well_tvoc_sensor_ != nullptr) {
+    this->feed_rolling_average_(Sen6xChannel::TVOC_WELL, metrics.tvoc_well);
+    this->publish_channel_(Sen6xChannel::TVOC_WELL, this->well_tvoc_sensor_,
+                           metrics.tvoc_well);
+  }
+  if (this->reset_tvoc_sensor_ != nullptr) {
+    this->feed_rolling_average_(Sen6xChannel::TVOC_RESET, metrics.tvoc_reset);
+    this->publish_channel_(Sen6xChannel::TVOC_RESET, this->reset_tvoc_sensor_,
+                           metrics.tvoc_reset);
+  }
+  if (this->tvoc_ethanol_sensor_ != nullptr)
+    this->publish_channel_(Sen6xChannel::TVOC_ETHANOL,
+                           this->tvoc_ethanol_sensor_, metrics.tvoc_ethanol);
+#endif
+}
+
+void Sen6xComponent::setup_aggregation_() {
+  if (!this->aggregation_enabled_())
+    return;
+  // Rings only for channels that are buffered (configured raw channels)
+  for (uint8_t i = 0; i < static_cast<uint8_t>(Sen6xChannel::COUNT); i++) {
+    Sen6xChannel channel = static_cast<Sen6xChannel>(i);
+    if (SEN6X_CHANNEL_SCALES[i].divisor > 0.0f &&
+        this->channel_sensor_(channel) != nullptr)
+      this->sample_rings_[i].allocate(this->aggregation_capacity_);
+  }
+  this->set_interval("aggregation", this->aggregation_interval_ms_,
+                     [this]() { this->publish_aggregates_(); });
+}
 
-  // Wait 100ms before starting cleaning, non-blocking
-  this->set_timeout("start_cleaning_delay", 100,
-                    [this]() { this->continue_fan_cleaning_(); });
+void Sen6xComponent::publish_aggregates_() {
+  for (uint8_t i = 0; i < static_cast<uint8_t>(Sen6xChannel::COUNT); i++) {
+    Sen6xSampleRing &ring = this->sample_rings_[i];
+    if (!ring.is_allocated())
+      continue;
+    Sen6xWindowStats stats = ring.stats(SEN6X_CHANNEL_SCALES[i].is_signed);
+    if (stats.count == 0)
+      continue; // Nothing measured in this window (cleaning, idle, ...)
+
+    Sen6xChannel channel = static_cast<Sen6xChannel>(i);
+    float value =
+        sen6x_channel_value(channel, stats.get(this->channel_aggregates_[i]));
+    this->publish_channel_(channel, this->channel_sensor_(channel), value);
+
+    // One pass over the window's VOC words for all TVOC estimates
+    if (channel == Sen6xChannel::VOC_INDEX)
+      this->publish_tvoc_estimates_(
+          EnvironmentalPhysics::derive(ring.samples(), ring.count()));
+    ring.clear();
+  }
 }
 
-void Sen6xComponent::continue_fan_cleaning_() {
+void Sen6xComponent::publish_channel_(Sen6xChannel channel,
+                                      sensor::Sensor *sens, float value) {
+  if (sens == nullptr)
+    return;
+  Sen6xPublishFilter &filter =
+      this->publish_filters_[static_cast<uint8_t>(channel)];
+  uint32_t now = millis();
+
+  float deadband = filter.deadband;
+  if (std::isnan(deadband) && this->publish_on_change_only_)
+    deadband = 0.0f;
 
-  ESP_LOGD(TAG, "Starting fan cleaning...");
-  if (this->write_command_(SEN6X_CMD_START_FAN_CLEANING)) {
-    ESP_LOGI(TAG, "Fan cleaning started. Measurement will resume in 12s.");
+  // Unfiltered channels, first value and heartbeat always publish
+  if (!std::isnan(deadband) && !std::isnan(filter.last_value)) {
+    bool heartbeat_due = filter.heartbeat_ms > 0 &&
+                         now - filter.last_publish_ms >= filter.heartbeat_ms;
+    if (!heartbeat_due && std::fabs(value - filter.last_value) <= deadband)
+      return;
+  }
 
-    // Set software state and update binary sensor immediately
-    this->fan_cleaning_active_state_ = true;
-    if (this->fan_cleaning_active_binary_sensor_ != nullptr)
-      this->fan_cleaning_active_binary_sensor_->publish_state(true);
+  filter.last_value = value;
+  filter.last_publish_ms = now;
+  sens->publish_state(value);
+}
 
-    this->set_timeout("resume_measurement", 12000, [this]() {
-      ESP_LOGI(TAG, "Resuming measurement after fan cleaning...");
-      this->start_measurement_();
+void Sen6xComponent::read_device_status_() {
+  // Device status is 2 words (4 bytes)
+  this->queue_read_(SEN6X_CMD_GET_STATUS, 2,
+                    [this](bool ok, const uint16_t *status_words,
+                           uint8_t words) {
+                      if (!ok) {
+                        ESP_LOGW(TAG, "Failed to read device status");
+                        return;
+                      }
+                      this->capture_(SEN6X_CMD_GET_STATUS, status_words,
+                                     words);
+                      this->handle_device_status_(
+                          ((uint32_t)status_words[0] << 16) | status_words[1]);
+                    });
+}
+
+void Sen6xComponent::handle_device_status_(uint32_t device_status) {
+  // Only bit transitions are published; the first status publishes all
+  uint32_t changed = this->device_status_valid_
+                         ? device_status ^ this->last_device_status_
+                         : 0xFFFFFFFF;
+  bool first = !this->device_status_valid_;
+  this->last_device_status_ = device_status;
+  this->device_status_valid_ = true;
+  if (changed == 0) {
+    ESP_LOGV(TAG, "Device Status unchanged: 0x%08X", device_status);
+    return;
+  }
+  ESP_LOGD(TAG, "Device Status: 0x%08X", device_status);
+
+#ifdef USE_SEN6X_TEXT_SENSOR
+  // Publish Status Hex
+  if (this->status_text_sensor_ != nullptr) {
+    char hex_value[11];
+    snprintf(hex_value, sizeof(hex_value), "0x%08X",
+             (unsigned int)device_status);
+    this->status_text_sensor_->publish_state(hex_value);
+  }
+#endif
+
+#ifdef USE_SEN6X_BINARY_SENSOR
+  // Publish Binary Sensors
+  // Bit definitions based on Sensirion SEN6x datasheet/driver
+  if (this->fan_error_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_FAN_SPEED_WARNING))
+    this->fan_error_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_FAN_SPEED_WARNING) != 0);
+
+  if (this->rht_error_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_RHT_ERROR))
+    this->rht_error_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_RHT_ERROR) != 0);
+
+  if (this->gas_error_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_GAS_ERROR))
+    this->gas_error_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_GAS_ERROR) != 0);
+
+  if (this->pm_error_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_PM_ERROR))
+    this->pm_error_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_PM_ERROR) != 0);
+
+  // LDIR/Laser Error (Bit 17 or 12?)
+  // Common driver maps Bit 17 to Laser Error
+  if (this->laser_error_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_LASER_ERROR))
+    this->laser_error_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_LASER_ERROR) != 0);
+
+  // Fan Warning (Bit 21 is technically Fan Speed Warning)
+  if (this->fan_warning_binary_sensor_ != nullptr &&
+      (changed & SEN6X_STATUS_FAN_SPEED_WARNING))
+    this->fan_warning_binary_sensor_->publish_state(
+        (device_status & SEN6X_STATUS_FAN_SPEED_WARNING) != 0);
+
+  // Fan Cleaning Active
+  // Datasheet does not define a dedicated status bit for this.
+  // We use our internal software state (its transitions are published by
+  // start_fan_cleaning_(), only the initial state is published here).
+  if (this->fan_cleaning_active_binary_sensor_ != nullptr && first)
+    this->fan_cleaning_active_binary_sensor_->publish_state(
+        this->fan_cleaning_active_state_);
+#else
+  (void)first;
+#endif
+
+  // Log warnings for debugging (preserved), on rising edges only
+  uint32_t raised = changed & device_status;
+  if (raised & SEN6X_STATUS_FAN_SPEED_WARNING)
+    ESP_LOGW(TAG, "Status: Fan Speed Warning");
+  if (raised & SEN6X_STATUS_GAS_ERROR)
+    ESP_LOGW(TAG, "Status: Gas Error");
+  if (raised & SEN6X_STATUS_PM_ERROR)
+    ESP_LOGW(TAG, "Status: PM Error");
+}
+
+// Decimation: a group with factor N runs on every Nth update() (0 = never,
+// READBACK then only runs at boot)
+bool Sen6xComponent::poll_group_due_(Sen6xPollGroup group, bool force) {
+  uint8_t index = static_cast<uint8_t>(group);
+  uint8_t factor = this->decimation_[index];
+  if (factor == 0)
+    return false;
+  bool due = force || this->decimation_counter_[index] == 0;
+  // Counts cycles since the last run (wraps to 0 when the next one is due)
+  this->decimation_counter_[index] =
+      ((due ? 0 : this->decimation_counter_[index]) + 1) % factor;
+  return due;
+}
+
+// Adaptive status polling: every N cycles while the status is clean, every
+// cycle while any flag is latched (status flags stay set until cleared)
+bool Sen6xComponent::status_poll_due_() {
+  return this->poll_group_due_(Sen6xPollGroup::STATUS,
+                               !this->device_status_valid_ ||
+                                   this->last_device_status_ != 0);
+}
+
+void Sen6xComponent::read_device_configuration_() {
+  // Read Ambient Pressure (0x6720)
+  this->queue_read_(
+      SEN6X_CMD_GET_AMBIENT_PRESSURE, 1,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok)
+          return;
+        // Scale checks needed. Assuming int16 raw hPa for now based on common
+        // drivers.
+        int16_t pressure = (int16_t)data[0];
+        ESP_LOGD(TAG, "Ambient Pressure: %d", pressure);
+        if (this->ambient_pressure_sensor_ != nullptr)
+          this->ambient_pressure_sensor_->publish_state(pressure); // Scaling 1.0
+
+#ifdef USE_SEN6X_NUMBER
+        // Sync Number Component
+        if (this->ambient_pressure_compensation_number_ != nullptr) {
+          this->ambient_pressure_compensation_number_->publish_state(pressure);
+        }
+#endif
+      });
+
+  // Read Sensor Altitude (0x6736)
+  this->queue_read_(
+      SEN6X_CMD_GET_SENSOR_ALTITUDE, 1,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok)
+          return;
+        int16_t altitude = (int16_t)data[0];
+        ESP_LOGD(TAG, "Sensor Altitude read from device: %d", altitude);
+
+        // SEN6x doesn't persist altitude internally - it's volatile.
+        // After boot, the sensor reports 0 even though we wrote a value in
+        // setup(). Use the NVS value for both sensor and number if we
+        // restored it.
+        if (!std::isnan(this->pending_altitude_)) {
+          // We restored from NVS - use that value (more accurate than 0)
+          float nvs_altitude = this->pending_altitude_;
+          if (this->sensor_altitude_sensor_ != nullptr)
+            this->sensor_altitude_sensor_->publish_state(nvs_altitude);
+          // Number already published in setup(), skip here
+        } else {
+          // No NVS value - use what sensor reports
+          if (this->sensor_altitude_sensor_ != nullptr)
+            this->sensor_altitude_sensor_->publish_state(altitude);
+#ifdef USE_SEN6X_NUMBER
+          if (this->altitude_compensation_number_ != nullptr)
+            this->altitude_compensation_number_->publish_state(altitude);
+#endif
+        }
+      });
+}
+
+// Write phase of a queued transaction. process_transactions_() only runs
+// with no transaction in flight and while the sensor task is idle, so the
+// write never interleaves with another command's read.
+bool Sen6xComponent::write_command_(uint16_t command) {
+  uint8_t data[2];
+  data[0] = (command >> 8) & 0xFF;
+  data[1] = command & 0xFF;
+  return this->bus_write_(command, data, 2) == i2c::ERROR_OK;
+}
+
+bool Sen6xComponent::write_command_with_words_(uint16_t command,
+                                               const uint16_t *data,
+                                               uint8_t words) {
+  uint8_t buffer[2 + SEN6X_MAX_REQUEST_WORDS * 3];
+  if (words > SEN6X_MAX_REQUEST_WORDS)
+    return false;
+  buffer[0] = (command >> 8) & 0xFF;
+  buffer[1] = command & 0xFF;
+  sen6x_pack_frame(data, words, &buffer[2]);
+  return this->bus_write_(command, buffer, 2 + words * 3) == i2c::ERROR_OK;
+}
+
+// Both callbacks, in order (either may be empty)
+static Sen6xTransactionCallback
+sen6x_chain_callbacks(Sen6xTransactionCallback &&first,
+                      Sen6xTransactionCallback &&second) {
+  if (!first)
+    return std::move(second);
+  if (!second)
+    return std::move(first);
+  return [first = std::move(first), second = std::move(second)](
+             bool ok, const uint16_t *data, uint8_t words) {
+    first(ok, data, words);
+    second(ok, data, words);
+  };
+}
 
-      // Clear software state
-      this->fan_cleaning_active_state_ = false;
-      this->last_fan_cleaning_end_time_ = millis();
-      if (this->fan_cleaning_active_binary_sensor_ != nullptr)
-        this->fan_cleaning_active_binary_sensor_->publish_state(false);
+bool Sen6xComponent::start_measurement_(Sen6xTransactionCallback &&done) {
+  this->start_waiters_ =
+      sen6x_chain_callbacks(std::move(this->start_waiters_), std::move(done));
+
+  // SEN63C/SEN69C: keep >= 24s between two starts (CO2 sensor restart)
+  uint32_t since_start = millis() - this->last_start_ms_;
+  if (this->start_sent_ && sen6x_model_has_start_gap(this->model_) &&
+      since_start < SEN6X_CO2_RESTART_GAP_MS) {
+    if (this->start_deferred_)
+      return true; // Joins the Start already waiting
+    uint32_t wait = SEN6X_CO2_RESTART_GAP_MS - since_start;
+    ESP_LOGD(TAG, "Start measurement deferred by %u ms (restart gap)",
+             (unsigned int)wait);
+    this->start_deferred_ = true;
+    this->set_timeout("start_measurement", wait, [this]() {
+      this->start_deferred_ = false;
+      this->start_measurement_();
     });
-  } else {
-    ESP_LOGW(TAG, "Failed to start fan cleaning");
-    this->start_measurement_();
+    return true;
   }
+  this->cancel_deferred_start_();
+  this->start_sent_ = true;
+  this->last_start_ms_ = millis();
+  Sen6xTransactionCallback waiters = std::move(this->start_waiters_);
+  this->start_waiters_ = nullptr;
+  return this->queue_write_(
+      SEN6X_CMD_START_MEASUREMENT, nullptr, 0,
+      [this, waiters = std::move(waiters)](bool ok, const uint16_t *data,
+                                           uint8_t words) {
+        // The queue may have held the Start back: the gap counts from here
+        this->last_start_ms_ = millis();
+        if (ok) {
+          this->measurement_start_ms_ = millis();
+          this->measurement_running_ = true;
+        }
+        // A new run: CO2 from before the stop must not approve an FRC
+        this->co2_stability_.reset();
+        // Measurement restart resets the sensor's 1s cadence
+        this->reset_phase_lock_();
+        if (waiters) {
+          waiters(ok, data, words);
+        } else if (!ok) {
+          ESP_LOGW(TAG, "Failed to start measurement");
+        }
+      },
+      SEN6X_START_MEASUREMENT_TIME_MS);
 }
 
-void Sen6xComponent::execute_preferences_reset_() {
-  ESP_LOGW(TAG, "Resetting all preferences to defaults/factory...");
+// The waiting callbacks stay queued for the next Start
+void Sen6xComponent::cancel_deferred_start_() {
+  if (!this->start_deferred_)
+    return;
+  ESP_LOGD(TAG, "Deferred start measurement cancelled");
+  this->cancel_timeout("start_measurement");
+  this->start_deferred_ = false;
+}
+
+bool Sen6xComponent::stop_measurement_(Sen6xTransactionCallback &&done) {
+  this->cancel_deferred_start_();
+  this->measurement_running_ = false;
+  this->co2_stability_.reset();
+  if (!done)
+    done = [](bool ok, const uint16_t *data, uint8_t words) {
+      if (!ok)
+        ESP_LOGW(TAG, "Failed to stop measurement");
+    };
+  return this->queue_write_(SEN6X_CMD_STOP_MEASUREMENT, nullptr, 0,
+                            std::move(done), SEN6X_STOP_MEASUREMENT_TIME_MS);
+}
+
+void Sen6xComponent::start_fan_cleaning_() {
+  if (this->fan_cleaning_active_state_)
+    return;
+  if (this->boot_phase_ != Sen6xBootPhase::READY ||
+      this->breaker_state_ != Sen6xBreakerState::CLOSED ||
+      this->idle_window_active_ || this->reconfigure_active_) {
+    ESP_LOGW(TAG, "Sensor busy, fan cleaning not started");
+    return;
+  }
+
+  // Readings are skipped from here on (update() checks the state)
+  this->fan_cleaning_active_state_ = true;
+#ifdef USE_SEN6X_BINARY_SENSOR
+  if (this->fan_cleaning_active_binary_sensor_ != nullptr)
+    this->fan_cleaning_active_binary_sensor_->publish_state(true);
+#endif
+
+  // Fan cleaning is Idle-only: the queue holds it back for the full Stop
+  // execution time (1400 ms). A duty-cycle sleep already is Idle Mode.
+  ESP_LOGD(TAG, "Stopping measurement to start fan cleaning...");
+  if (!this->duty_sleeping_())
+    this->stop_measurement_();
+  this->queue_write_(
+      SEN6X_CMD_START_FAN_CLEANING, nullptr, 0,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to start fan cleaning");
+          this->finish_fan_cleaning_(false);
+          return;
+        }
+        ESP_LOGI(TAG, "Fan cleaning started. Measurement will resume in %us.",
+                 (unsigned int)(SEN6X_FAN_CLEANING_TIME_MS / 1000));
+        this->set_timeout("resume_measurement", SEN6X_FAN_CLEANING_TIME_MS,
+                          [this]() { this->finish_fan_cleaning_(true); });
+      });
+}
+
+void Sen6xComponent::finish_fan_cleaning_(bool cleaned) {
+  if (cleaned)
+    ESP_LOGI(TAG, "Resuming measurement after fan cleaning...");
+  this->resume_measurement_();
+
+  // Clear software state
+  this->fan_cleaning_active_state_ = false;
+  this->last_fan_cleaning_end_time_ = millis();
+#ifdef USE_SEN6X_BINARY_SENSOR
+  if (this->fan_cleaning_active_binary_sensor_ != nullptr)
+    this->fan_cleaning_active_binary_sensor_->publish_state(false);
+#endif
+  if (!cleaned)
+    return;
 
-  // 1. Numbers -> Set to NAN (Invalidate to force read from device on next
-  // boot)
-  float nan_val = NAN;
-  if (this->altitude_preference_.save(&nan_val))
-    ESP_LOGD(TAG, "Invalidated Altitude preference");
-  if (this->ambient_pressure_preference_.save(&nan_val))
-    ESP_LOGD(TAG, "Invalidated Pressure preference");
-  if (this->temperature_offset_preference_.save(&nan_val))
-    ESP_LOGD(TAG, "Invalidated Temp Offset preference");
+  // Manual and automatic cleanings both restart the runtime count
+  this->cleaning_record_.runtime_s = 0;
+  this->cleaning_record_.cleanings++;
+  this->runtime_remainder_ms_ = 0;
+  this->cleaning_due_ = false;
+  this->quiet_detector_.reset();
+  this->save_cleaning_record_();
+}
 
-  // 2. Switches -> Set to Safety Defaults
-  // Note: voc_tuning_preference_ removed - VOC tuning is now YAML-only
+void Sen6xComponent::abort_fan_cleaning_() {
+  if (!this->fan_cleaning_active_state_)
+    return;
+  // The fan may have stopped early; the cleaning stays due and the automatic
+  // schedule retries it, so the runtime count is kept
+  ESP_LOGW(TAG, "Fan cleaning interrupted");
+  this->cancel_timeout("resume_measurement");
+  this->fan_cleaning_active_state_ = false;
+  this->last_fan_cleaning_end_time_ = millis();
+#ifdef USE_SEN6X_BINARY_SENSOR
+  if (this->fan_cleaning_active_binary_sensor_ != nullptr)
+    this->fan_cleaning_active_binary_sensor_->publish_state(false);
+#endif
+}
 
-  bool co2_asc_default = true; // Enabled
-  if (this->co2_asc_preference_.save(&co2_asc_default))
-    ESP_LOGD(TAG, "Reset CO2 ASC preference to Enabled");
+#ifdef USE_SEN6X_BUTTON
+void Sen6xComponent::execute_preferences_reset_() {
+  ESP_LOGW(TAG, "Resetting all preferences to defaults/factory...");
 
-  bool auto_clean_default = false; // Disabled
-  if (this->auto_cleaning_preference_.save(&auto_clean_default))
-    ESP_LOGD(TAG, "Reset Auto Cleaning preference to Disabled");
+  // One write of a default record replaces the whole configuration; ESPHome
+  // has no erase. Numbers -> NAN (read from device on next boot), switches
+  // -> safety defaults (ASC enabled, auto cleaning disabled).
+  // The VOC baselines are learned, not configured: dropping them would send
+  // the VOC index back through its 12 h learning phase, so they are kept.
+  Sen6xBaselines baselines = this->config_.voc_baselines;
+  this->reset_config_();
+  this->config_.voc_baselines = baselines;
+  this->commit_config_(); // Also drops a pending deferred commit
 
   ESP_LOGI(TAG, "Preferences reset complete. Restarting is recommended.");
 }
+#endif
+#ifdef USE_SEN6X_BUTTON
 void Sen6xComponent::execute_device_reset_() {
+  // The reset restarts measurement, which a window or cleaning must not see
+  if (this->boot_phase_ != Sen6xBootPhase::READY ||
+      this->breaker_state_ != Sen6xBreakerState::CLOSED ||
+      this->idle_window_active_ || this->fan_cleaning_active_state_ ||
+      this->reconfigure_active_) {
+    ESP_LOGW(TAG, "Sensor busy, device reset not started");
+    return;
+  }
+
   ESP_LOGD(TAG, "Resetting device...");
-  if (this->write_command_(SEN6X_CMD_DEVICE_RESET)) {
-    ESP_LOGI(TAG, "Device reset command sent");
-    // Re-run setup after a short delay? Or just let polling resume?
-    // A reset usually requires re-initialization (start measurement).
-    // Let's mark component as failed or try to re-init in next loop?
-    // Ideally, we should restart measurement after reset.
-    this->status_set_warning();
-    // Non-blocking delay for reset recovery
-    this->set_timeout("reset_recovery", 100, [this]() {
-      this->start_measurement_();
-      this->status_clear_warning();
-    });
-  } else {
-    ESP_LOGW(TAG, "Failed to reset device");
+  this->reconfigure_active_ = true;
+  this->status_set_warning();
+  this->queue_write_(
+      SEN6X_CMD_DEVICE_RESET, nullptr, 0,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to reset device");
+          this->reconfigure_active_ = false;
+          this->status_clear_warning();
+          return;
+        }
+        // The reset leaves the sensor idle with its volatile settings
+        // (altitude, ASC, tuning, compensation) lost
+        ESP_LOGI(TAG, "Device reset complete, restoring configuration");
+        this->reapply_volatile_configuration_();
+        this->status_clear_warning();
+      },
+      SEN6X_DEVICE_RESET_TIME_MS);
+}
+#endif
+
+// ========== PERSISTED CONFIGURATION ==========
+
+void Sen6xComponent::reset_config_() {
+  this->config_ = Sen6xConfigRecord{};
+  this->config_.version = SEN6X_CONFIG_VERSION;
+  this->config_.co2_asc = true; // Datasheet default
+  this->config_.auto_cleaning = false;
+  this->config_.altitude = NAN;
+  this->config_.ambient_pressure = NAN;
+  this->config_.temperature_offset = NAN;
+  this->config_.outdoor_co2_ppm = NAN;
+}
+
+void Sen6xComponent::load_config_() {
+  this->config_preference_ =
+      global_preferences->make_preference<Sen6xConfigRecord>(
+          this->preference_hash_ + 1, true);
+  Sen6xConfigRecord record;
+  if (this->config_preference_.load(&record) &&
+      record.version == SEN6X_CONFIG_VERSION) {
+    this->config_ = record;
+    ESP_LOGI(TAG, "Loaded configuration record (v%u)", record.version);
+    return;
+  }
+
+  this->reset_config_();
+  uint16_t migrated = this->load_legacy_config_();
+  if (migrated != 0) {
+    ESP_LOGI(TAG, "Migrated preferences to the configuration record");
+    // Written now, not deferred: the old slots are dropped only once the
+    // record holds their values, so a later reset cannot be undone by them
+    if (this->commit_config_())
+      this->invalidate_legacy_config_(migrated);
+  }
+}
+
+// Earlier releases kept one preference object per setting (hash + 2..8);
+// read once so an upgrade keeps the user's settings
+uint16_t Sen6xComponent::load_legacy_config_() {
+  uint16_t found = 0;
+  auto load = [this, &found](uint32_t offset, auto &field, bool in_flash) {
+    auto value = field;
+    if (global_preferences
+            ->make_preference<decltype(value)>(this->preference_hash_ + offset,
+                                               in_flash)
+            .load(&value)) {
+      field = value;
+      found |= 1u << offset;
+    }
+  };
+  if (this->store_baseline_)
+    load(2, this->config_.voc_baselines, true);
+  load(3, this->config_.co2_asc, false);
+  load(4, this->config_.auto_cleaning, false);
+  load(5, this->config_.altitude, false);
+  load(6, this->config_.ambient_pressure, false);
+  load(7, this->config_.temperature_offset, false);
+  load(8, this->config_.outdoor_co2_ppm, false);
+  return found;
+}
+
+void Sen6xComponent::invalidate_legacy_config_(uint16_t offsets) {
+  const Sen6xLegacyTombstone tombstone{};
+  for (uint32_t offset = 2; offset <= 8; offset++) {
+    if ((offsets & (1u << offset)) == 0)
+      continue;
+    // Same storage as the old slot: the baseline was in flash, the rest not
+    bool in_flash = offset == 2;
+    ESPPreferenceObject slot =
+        global_preferences->make_preference<Sen6xLegacyTombstone>(
+            this->preference_hash_ + offset, in_flash);
+    if (slot.save(&tombstone) && in_flash)
+      this->record_flash_write_();
+  }
+}
+
+void Sen6xComponent::mark_config_dirty_() {
+  // The first change schedules the commit; later ones ride along with it
+  if (this->config_dirty_)
+    return;
+  this->config_dirty_ = true;
+  this->set_timeout("config_commit", SEN6X_CONFIG_COMMIT_DELAY_MS,
+                    [this]() { this->commit_config_(); });
+}
+
+bool Sen6xComponent::commit_config_() {
+  this->cancel_timeout("config_commit");
+  this->config_dirty_ = false;
+  if (!this->config_preference_.save(&this->config_)) {
+    ESP_LOGW(TAG, "Could not save configuration record");
+    return false;
   }
+  this->record_flash_write_();
+  ESP_LOGD(TAG, "Configuration record saved (%u writes since boot)",
+           (unsigned int)this->flash_write_count_);
+  return true;
+}
+
+void Sen6xComponent::record_flash_write_() {
+  this->flash_write_count_++;
+#ifdef USE_SEN6X_FLASH_WRITES
+  if (this->flash_writes_sensor_ != nullptr)
+    this->flash_writes_sensor_->publish_state(this->flash_write_count_);
+#endif
+}
+
+void Sen6xComponent::on_shutdown() {
+  if (this->config_dirty_)
+    this->commit_config_();
+  if (this->cleaning_record_dirty_)
+    this->save_cleaning_record_();
+  this->save_rolling_averages_();
 }
 
 // Sen6xNumber::setup removed.
@@ -1095,75 +1951,111 @@ void Sen6xComponent::execute_device_reset_() {
 bool Sen6xComponent::write_altitude_compensation_(float altitude) {
   uint16_t alt_int = (uint16_t)altitude;
   ESP_LOGD(TAG, "Writing Altitude Compensation: %d m", alt_int);
-  if (this->write_command_with_data_(SEN6X_CMD_GET_SENSOR_ALTITUDE, alt_int)) {
-    ESP_LOGI(TAG, "Altitude Compensation written");
-    // Manual persistence save
-    if (this->altitude_preference_.save(&altitude)) {
-      ESP_LOGD(TAG, "Altitude persisted to flash");
-    }
-    if (this->sensor_altitude_sensor_ != nullptr) {
-      this->sensor_altitude_sensor_->publish_state(alt_int);
-    }
-    return true;
-  } else {
-    ESP_LOGW(TAG, "Failed to write Altitude Compensation");
-    return false;
-  }
+  return this->queue_write_(
+      SEN6X_CMD_GET_SENSOR_ALTITUDE, &alt_int, 1,
+      [this, altitude, alt_int](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to write Altitude Compensation");
+          return;
+        }
+        ESP_LOGI(TAG, "Altitude Compensation written");
+        this->update_config_(this->config_.altitude, altitude);
+        if (this->sensor_altitude_sensor_ != nullptr) {
+          this->sensor_altitude_sensor_->publish_state(alt_int);
+        }
+      });
 }
 
 // Public method for external barometric sensor integration (e.g., BME280)
 // This allows feeding real-time pressure data for CO2 compensation
 bool Sen6xComponent::set_ambient_pressure(float pressure_hpa) {
-  // Validate range per datasheet: 700-1200 hPa
-  if (pressure_hpa < 700.0f || pressure_hpa > 1200.0f) {
+  // Validate range per datasheet: 700-1200 hPa (NAN = source not ready)
+  if (!(pressure_hpa >= 700.0f && pressure_hpa <= 1200.0f)) {
     ESP_LOGW(TAG, "Ambient pressure %.1f hPa out of range (700-1200), ignoring",
              pressure_hpa);
     return false;
   }
 
-  // Only applicable to models with CO2: SEN63C, SEN66, SEN69C
-  if (this->model_ != Sen6xModel::SEN63C && this->model_ != Sen6xModel::SEN66 &&
-      this->model_ != Sen6xModel::SEN69C) {
+  // Only applicable to models with CO2
+  if (!sen6x_model_has_co2(this->model_)) {
     // Silently ignore for models without CO2 (no point in logging every time)
     return true;
   }
 
-  // Only write if pressure changed significantly (±1 hPa) to reduce I2C writes
-  // Datasheet: volatile setting, but doesn't need constant updates
-  static float last_written_pressure = 0.0f;
-  if (fabsf(pressure_hpa - last_written_pressure) < 1.0f &&
-      last_written_pressure != 0.0f) {
-    // Pressure hasn't changed enough, skip write
+  // Barometers report often and noisily: filter every reading, but let the
+  // rate limiter decide whether (and when) it reaches the sensor
+  this->pressure_filtered_ = this->pressure_filter_.feed(pressure_hpa);
+  this->schedule_pressure_write_();
+  return true;
+}
+
+bool Sen6xComponent::pressure_write_needed_() const {
+  if (std::isnan(this->last_written_pressure_))
     return true;
-  }
+  // The register holds whole hPa; an unchanged value is never rewritten
+  return fabsf(this->pressure_filtered_ - this->last_written_pressure_) >=
+             this->pressure_hysteresis_ &&
+         lroundf(this->pressure_filtered_) !=
+             lroundf(this->last_written_pressure_);
+}
 
-  ESP_LOGD(TAG, "External pressure sensor: %.1f hPa (changed from %.1f)",
-           pressure_hpa, last_written_pressure);
+void Sen6xComponent::schedule_pressure_write_() {
+  // An armed write picks up the newest filtered value when it fires
+  if (this->pressure_write_pending_ || !this->pressure_write_needed_())
+    return;
+  uint32_t elapsed = millis() - this->last_pressure_write_ms_;
+  uint32_t wait = 0;
+  if (!std::isnan(this->last_written_pressure_) &&
+      elapsed < this->pressure_min_interval_ms_)
+    wait = this->pressure_min_interval_ms_ - elapsed;
+  this->pressure_write_pending_ = true;
+  // Never from the barometer's callback itself (wait 0 = next loop)
+  this->set_timeout("pressure_write", wait,
+                    [this]() { this->flush_pressure_write_(); });
+}
 
-  if (this->write_ambient_pressure_compensation_(pressure_hpa)) {
-    last_written_pressure = pressure_hpa;
-    return true;
+void Sen6xComponent::flush_pressure_write_() {
+  // The filtered value may have settled back within the hysteresis
+  if (!this->pressure_write_needed_()) {
+    this->pressure_write_pending_ = false;
+    return;
   }
-  return false;
+  ESP_LOGD(TAG, "External pressure: %.1f hPa filtered (last written %.1f)",
+           this->pressure_filtered_, this->last_written_pressure_);
+  // Not persisted: the source republishes after boot, and storing every
+  // change would wear the flash. Stays pending until the write completes.
+  if (!this->write_ambient_pressure_compensation_(this->pressure_filtered_,
+                                                  false, true))
+    this->pressure_write_pending_ = false;
 }
 
-bool Sen6xComponent::write_ambient_pressure_compensation_(float pressure) {
+bool Sen6xComponent::write_ambient_pressure_compensation_(float pressure,
+                                                          bool persist,
+                                                          bool feed) {
   uint16_t press_int = (uint16_t)lroundf(pressure);
   ESP_LOGD(TAG, "Writing Ambient Pressure Compensation: %d hPa", press_int);
-  if (this->write_command_with_data_(SEN6X_CMD_GET_AMBIENT_PRESSURE,
-                                     press_int)) {
-    ESP_LOGI(TAG, "Ambient Pressure Compensation written");
-    if (this->ambient_pressure_preference_.save(&pressure)) {
-      ESP_LOGD(TAG, "Ambient Pressure persisted to flash");
-    }
-    if (this->ambient_pressure_sensor_ != nullptr) {
-      this->ambient_pressure_sensor_->publish_state(press_int);
-    }
-    return true;
-  } else {
-    ESP_LOGW(TAG, "Failed to write Ambient Pressure Compensation");
-    return false;
-  }
+  return this->queue_write_(
+      SEN6X_CMD_GET_AMBIENT_PRESSURE, &press_int, 1,
+      [this, pressure, press_int, persist, feed](bool ok, const uint16_t *data,
+                                                 uint8_t words) {
+        if (feed)
+          this->pressure_write_pending_ = false;
+        if (!ok) {
+          // A failed feed write is retried with the next reading
+          ESP_LOGW(TAG, "Failed to write Ambient Pressure Compensation");
+          return;
+        }
+        ESP_LOGI(TAG, "Ambient Pressure Compensation written");
+        if (feed) {
+          this->last_written_pressure_ = pressure;
+          this->last_pressure_write_ms_ = millis();
+        }
+        if (persist)
+          this->update_config_(this->config_.ambient_pressure, pressure);
+        if (this->ambient_pressure_sensor_ != nullptr) {
+          this->ambient_pressure_sensor_->publish_state(press_int);
+        }
+      });
 }
 
 bool Sen6xComponent::write_temperature_offset_(float offset) {
@@ -1184,359 +2076,1747 @@ bool Sen6xComponent::write_temperature_offset_(float offset) {
   uint16_t payload[4] = {(uint16_t)offset_ticks, (uint16_t)slope, time_constant,
                          slot};
 
-  uint8_t buffer[2 + (4 * 3)]; // Cmd (2) + 4 words * (2 data + 1 CRC)
-  buffer[0] = 0x60;
-  buffer[1] = 0xB2;
+  return this->queue_write_(
+      SEN6X_CMD_SET_TEMP_OFFSET, payload, 4,
+      [this, offset, slot](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to write Temperature Offset");
+          return;
+        }
+        ESP_LOGI(TAG, "Temperature Offset written to slot %d", slot);
+        this->update_config_(this->config_.temperature_offset, offset);
+      });
+}
+
+bool Sen6xComponent::write_temperature_compensation_(
+    const TemperatureCompensation &compensation) {
+  // Datasheet 4.8.14: Requires 4 words (12 bytes of data)
+  // Word 0: Offset (int16, scaled * 200)
+  // Word 1: Slope (int16, scaled * 10000)
+  // Word 2: Time Constant (uint16, seconds)
+  // Word 3: Slot (uint16, MUST be 0-4) -> Use slot 0 (base self-heating)
+
+  ESP_LOGD(TAG, "Writing Temp Compensation: offset=%d, slope=%d, time=%d",
+           compensation.offset, compensation.normalized_offset_slope,
+           compensation.time_constant);
+
+  uint16_t payload[4] = {
+      (uint16_t)compensation.offset,
+      (uint16_t)compensation.normalized_offset_slope,
+      compensation.time_constant,
+      0 // Slot 0
+  };
+
+  return this->queue_write_(
+      SEN6X_CMD_SET_TEMP_OFFSET, payload, 4,
+      [compensation](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok) {
+          ESP_LOGW(TAG, "Failed to write Temperature Compensation");
+          return;
+        }
+        ESP_LOGI(TAG,
+                 "Temperature Compensation written (offset=%.2f°C, "
+                 "slope=%.4f, time=%ds)",
+                 compensation.offset / 200.0f,
+                 compensation.normalized_offset_slope / 10000.0f,
+                 compensation.time_constant);
+      });
+}
+
+bool Sen6xComponent::write_voc_algorithm_tuning_(const GasTuning &tuning) {
+  // Command 0x60D0: Set VOC Algorithm Tuning Parameters
+  // Payload: 6 words (12 bytes)
+  uint16_t payload[6];
+  payload[0] = tuning.index_offset;
+  payload[1] = tuning.learning_time_offset_hours; // 12 default, 720 for WELL
+  payload[2] = tuning.learning_time_gain_hours;
+  payload[3] = tuning.gating_max_duration_minutes;
+  payload[4] = tuning.std_initial;
+  payload[5] = tuning.gain_factor;
+
+  ESP_LOGD(
+      TAG,
+      "VOC Tuning: idx=%d, offset=%dh, gain=%dh, gating=%dm, std=%d, factor=%d",
+      payload[0], payload[1], payload[2], payload[3], payload[4], payload[5]);
+
+  return this->queue_write_(SEN6X_CMD_SET_VOC_TUNING, payload, 6);
+}
+
+bool Sen6xComponent::write_nox_algorithm_tuning_(const GasTuning &tuning) {
+  // Command 0x60E1: Set NOx Algorithm Tuning Parameters
+  // Payload: 5 words (NOx has no std_initial parameter)
+  uint16_t payload[5];
+  payload[0] = tuning.index_offset;
+  payload[1] = tuning.learning_time_offset_hours; // 12 default, 720 for WELL
+  payload[2] = tuning.learning_time_gain_hours;
+  payload[3] = tuning.gating_max_duration_minutes;
+  payload[4] = tuning.gain_factor;
+
+  ESP_LOGD(TAG,
+           "NOx Tuning: idx=%d, offset=%dh, gain=%dh, gating=%dm, factor=%d",
+           payload[0], payload[1], payload[2], payload[3], payload[4]);
+
+  return this->queue_write_(SEN6X_CMD_SET_NOX_TUNING, payload, 5);
+}
+
+bool Sen6xComponent::write_rht_acceleration_(const RhtAcceleration &rht) {
+  // Command 0x6100: Set Temperature Acceleration Parameters
+  // Payload: 4 words (K, P, T1, T2)
+  // These are volatile (reset to defaults on power cycle)
+  // Must be called in Idle Mode (before start_measurement)
+  uint16_t payload[4];
+  payload[0] = rht.k;
+  payload[1] = rht.p;
+  payload[2] = rht.t1;
+  payload[3] = rht.t2;
+
+  ESP_LOGI(TAG, "RHT Acceleration: K=%d, P=%d, T1=%ds, T2=%ds", payload[0],
+           payload[1], payload[2], payload[3]);
+
+  return this->queue_write_(SEN6X_CMD_SET_RHT_ACCELERATION, payload, 4);
+}
+
+bool Sen6xComponent::write_co2_asc_(bool enabled) {
+  // Command 0x6711, 2 bytes (Padding + Status) + CRC
+  uint16_t data = enabled ? 0x0001 : 0x0000;
+  return this->queue_write_(SEN6X_CMD_SET_CO2_ASC, &data, 1);
+}
+
+// ========== FORCED CO2 RECALIBRATION ==========
+// FRC runs in the idle window: Stop -> wait 1400ms -> FRC (write, 500ms,
+// read correction) -> Start, all queued. It is only accepted after 3 min of
+// measurement since the last Start and, with a stability gate, once CO2 has
+// settled over the samples of that run.
+
+bool Sen6xComponent::start_forced_co2_calibration(float reference_ppm) {
+  if (!sen6x_model_has_co2(this->model_)) {
+    ESP_LOGW(TAG, "FRC not supported on this model (no CO2 sensor)");
+    return false;
+  }
+  if (std::isnan(reference_ppm))
+    reference_ppm = this->outdoor_co2_ppm_;
+  if (!(reference_ppm >= 0.0f && reference_ppm <= 65535.0f)) {
+    ESP_LOGW(TAG, "FRC rejected - invalid reference");
+    return false;
+  }
+  // Datasheet 4.8.31: operated in measurement mode for >= 3 min first
+  uint32_t running = millis() - this->measurement_start_ms_;
+  if (!this->measurement_running_ ||
+      running < SEN6X_FRC_MIN_MEASUREMENT_MS) {
+    ESP_LOGW(TAG, "FRC rejected - measuring for %u s, needs %u s",
+             this->measurement_running_ ? (unsigned int)(running / 1000) : 0U,
+             (unsigned int)(SEN6X_FRC_MIN_MEASUREMENT_MS / 1000));
+    return false;
+  }
+  if (!this->co2_settled_(reference_ppm))
+    return false;
+
+  uint16_t ref_ppm = (uint16_t)reference_ppm;
+  ESP_LOGI(TAG, "Starting Forced CO2 Recalibration with reference: %u ppm",
+           (unsigned int)ref_ppm);
+  this->request_idle_configuration_(Sen6xIdleAction::FORCED_CO2_RECAL,
+                                    ref_ppm);
+  return true;
+}
+
+bool Sen6xComponent::co2_settled_(float reference_ppm) const {
+  if (!this->co2_stability_.enabled())
+    return true;
+  uint16_t spread;
+  float mean;
+  if (!this->co2_stability_.evaluate(&spread, &mean)) {
+    ESP_LOGW(TAG, "FRC rejected - %u of %u CO2 samples collected",
+             (unsigned int)this->co2_stability_.count(),
+             (unsigned int)this->co2_stability_.size());
+    return false;
+  }
+  if (spread > this->co2_max_spread_) {
+    ESP_LOGW(TAG, "FRC rejected - CO2 not stable (spread %u > %u ppm)",
+             (unsigned int)spread, (unsigned int)this->co2_max_spread_);
+    return false;
+  }
+  float deviation = std::fabs(mean - reference_ppm);
+  if (!std::isnan(this->co2_max_deviation_) &&
+      deviation > this->co2_max_deviation_) {
+    ESP_LOGW(TAG,
+             "FRC rejected - CO2 mean %.0f ppm is %.0f ppm from the "
+             "reference (max %.0f)",
+             mean, deviation, this->co2_max_deviation_);
+    return false;
+  }
+  return true;
+}
+
+bool Sen6xComponent::perform_forced_co2_calibration_(uint16_t reference_ppm) {
+  // Datasheet 4.8.31: Forced CO2 Recalibration
+  // Must be called in Idle Mode (measurement stopped)
+  // Takes ~500ms, reads back correction value
+  // Calibration is PERSISTENT (stored in sensor EEPROM)
+
+  ESP_LOGI(TAG, "Executing Forced CO2 Recalibration with reference: %d ppm",
+           reference_ppm);
+
+  // Send command with reference value, wait 500ms, then read correction
+  // value (3 bytes: 2 data + 1 CRC) in the same transaction
+  Sen6xTransaction transaction{};
+  transaction.command = SEN6X_CMD_FORCED_CO2_RECAL;
+  transaction.payload[0] = reference_ppm;
+  transaction.payload_words = 1;
+  transaction.response_words = 1;
+  transaction.execution_time_ms = SEN6X_FRC_EXECUTION_TIME_MS;
+  transaction.callback = [this](bool ok, const uint16_t *data,
+                                uint8_t words) {
+    if (!ok) {
+      ESP_LOGW(TAG, "Failed to read FRC result");
+      return;
+    }
+    uint16_t correction = data[0];
+    if (correction == 0xFFFF) {
+      ESP_LOGW(TAG, "FRC failed - sensor returned error (0xFFFF)");
+      return;
+    }
+
+    // Correction value is (returned - 0x8000)
+    int16_t offset = (int16_t)(correction - 0x8000);
+    ESP_LOGI(TAG, "FRC successful! Correction offset: %d ppm (raw: 0x%04X)",
+             offset, correction);
+    ESP_LOGI(TAG, "FRC completed successfully - calibration persisted to "
+                  "sensor EEPROM");
+#ifdef USE_SEN6X_CO2_CORRECTION
+    if (this->co2_correction_sensor_ != nullptr)
+      this->co2_correction_sensor_->publish_state(offset);
+#endif
+    // Earlier samples predate the correction
+    this->co2_stability_.reset();
+  };
+  return this->queue_transaction_(std::move(transaction));
+}
+
+// ========== IDLE CONFIGURATION WINDOW ==========
+// Idle-only writes (altitude, ASC, FRC, CO2 factory reset, SHT heater) are
+// gathered and applied in a single Stop -> writes -> Start window once the
+// debounce elapses, so several changes cost one measurement gap.
+
+void Sen6xComponent::request_idle_configuration_(Sen6xIdleAction action,
+                                                 float value) {
+  uint8_t index = static_cast<uint8_t>(action);
+  if (!this->idle_requests_[index].pending) {
+    // Keep first-request order; repeated requests only update the value
+    this->idle_request_order_[this->idle_request_count_++] = action;
+  }
+  this->idle_requests_[index].pending = true;
+  this->idle_requests_[index].value = value;
+
+  // A window in progress picks up new requests in a follow-up window
+  if (this->idle_window_active_)
+    return;
+  this->set_timeout("idle_window", this->idle_window_debounce_ms_,
+                    [this]() { this->open_idle_window_(); });
+}
+
+void Sen6xComponent::open_idle_window_() {
+  if (this->idle_request_count_ == 0)
+    return;
+  if (this->boot_phase_ != Sen6xBootPhase::READY ||
+      this->fan_cleaning_active_state_ || this->reconfigure_active_) {
+    // Sensor busy (booting, cleaning or resetting) - try again later
+    this->set_timeout("idle_window", this->idle_window_debounce_ms_,
+                      [this]() { this->open_idle_window_(); });
+    return;
+  }
+
+  ESP_LOGD(TAG, "Opening idle configuration window (%u change(s))",
+           this->idle_request_count_);
+  this->idle_window_active_ = true;
+  // A restart-gap Start must not fire inside the window
+  this->cancel_deferred_start_();
+  // A duty-cycle sleep already is Idle Mode
+  if (!this->duty_sleeping_())
+    this->stop_measurement_();
+
+  std::copy(this->idle_request_order_,
+            this->idle_request_order_ + this->idle_request_count_,
+            this->idle_window_order_);
+  this->idle_window_count_ = this->idle_request_count_;
+
+  bool heater_activated = false;
+  for (uint8_t i = 0; i < this->idle_request_count_; i++) {
+    Sen6xIdleAction action = this->idle_request_order_[i];
+    Sen6xIdleRequest &request =
+        this->idle_requests_[static_cast<uint8_t>(action)];
+    request.pending = false;
+
+    switch (action) {
+    case Sen6xIdleAction::ALTITUDE:
+      this->write_altitude_compensation_(request.value);
+      break;
+    case Sen6xIdleAction::CO2_ASC: {
+      bool state = request.value != 0.0f;
+      this->write_co2_asc_(state);
+#ifdef USE_SEN6X_SWITCH
+      if (this->co2_asc_switch_ != nullptr)
+        this->co2_asc_switch_->publish_state(state);
+#endif
+      break;
+    }
+    case Sen6xIdleAction::FORCED_CO2_RECAL:
+      this->perform_forced_co2_calibration_((uint16_t)request.value);
+      break;
+#ifdef USE_SEN6X_BUTTON
+    case Sen6xIdleAction::CO2_FACTORY_RESET:
+      // Wait 1400ms for command execution (per datasheet)
+      this->queue_write_(
+          SEN6X_CMD_CO2_FACTORY_RESET, nullptr, 0,
+          [](bool ok, const uint16_t *data, uint8_t words) {
+            if (ok) {
+              ESP_LOGI(TAG, "CO2 calibration reset to factory defaults");
+            } else {
+              ESP_LOGE(TAG, "CO2 Factory Reset command failed!");
+            }
+          },
+          SEN6X_CO2_FACTORY_RESET_TIME_MS);
+      break;
+#endif
+    case Sen6xIdleAction::SHT_HEATER:
+      // 1300ms execution time, then the readback closes the window
+      this->queue_write_(
+          SEN6X_CMD_ACTIVATE_SHT_HEATER, nullptr, 0,
+          [this](bool ok, const uint16_t *data, uint8_t words) {
+            if (!ok) {
+              ESP_LOGW(TAG, "Failed to activate SHT Heater");
+              this->close_idle_window_();
+              return;
+            }
+            ESP_LOGI(TAG, "SHT Heater activated (200mW for 1s)");
+            // Counted from the completed activation (conservative)
+            this->sht_heater_activated_ms_ = millis();
+            this->sht_heater_polls_ = 0;
+            this->poll_sht_heater_();
+          },
+          SEN6X_SHT_HEATER_TIME_MS);
+      heater_activated = true;
+      break;
+    default:
+      break;
+    }
+  }
+  this->idle_request_count_ = 0;
+
+  // The heater cycle closes the window once its result was read back
+  if (!heater_activated)
+    this->close_idle_window_();
+}
+
+void Sen6xComponent::close_idle_window_() {
+  if (this->duty_sleeping_()) {
+    // A duty-cycle sleep stays in Idle Mode until the next wake-up
+    this->finish_idle_window_();
+    return;
+  }
+  // Restart measurement once for the whole window
+  this->start_measurement_(
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok)
+          ESP_LOGW(TAG, "Failed to start measurement");
+        this->finish_idle_window_();
+      });
+}
+
+void Sen6xComponent::finish_idle_window_() {
+  this->idle_window_active_ = false;
+  ESP_LOGD(TAG, "Idle configuration window closed");
+  // Changes requested during the window
+  if (this->idle_request_count_ > 0) {
+    this->set_timeout("idle_window", this->idle_window_debounce_ms_,
+                      [this]() { this->open_idle_window_(); });
+  }
+}
+
+void Sen6xComponent::abort_idle_window_() {
+  if (!this->idle_window_active_)
+    return;
+  ESP_LOGW(TAG, "Idle configuration window interrupted, re-queuing %u "
+                "change(s)",
+           this->idle_window_count_);
+  this->cancel_timeout("sht_heater_poll");
+  this->cancel_timeout("idle_window_close");
+  // Answer a deferred window Start now, so it cannot close a later window
+  this->cancel_deferred_start_();
+  Sen6xTransactionCallback waiters = std::move(this->start_waiters_);
+  this->start_waiters_ = nullptr;
+  if (waiters)
+    waiters(false, nullptr, 0);
+  this->idle_window_active_ = false;
+
+  for (uint8_t i = 0; i < this->idle_window_count_; i++) {
+    Sen6xIdleAction action = this->idle_window_order_[i];
+    if (action == Sen6xIdleAction::FORCED_CO2_RECAL) {
+      // The reference is only valid after 3 min of uninterrupted operation
+      ESP_LOGW(TAG, "Forced CO2 recalibration dropped, request it again");
+      continue;
+    }
+    // Holds the newer value if the action was requested again meanwhile
+    this->request_idle_configuration_(
+        action, this->idle_requests_[static_cast<uint8_t>(action)].value);
+  }
+  this->idle_window_count_ = 0;
+  // Changes requested during the window
+  if (this->idle_request_count_ > 0) {
+    this->set_timeout("idle_window", this->idle_window_debounce_ms_,
+                      [this]() { this->open_idle_window_(); });
+  }
+}
+
+// ========== SHT HEATER CYCLE ==========
+// The heater runs inside an idle window. Its RH/T result is polled from
+// 0x6790 until valid and published; the window stays open until 20s after
+// the activation (datasheet), so the restarted measurement, and the gas and
+// CO2 compensation fed by it, never sees heater-warmed RH/T.
+
+void Sen6xComponent::activate_sht_heater() {
+  ESP_LOGI(TAG, "SHT Heater cycle requested");
+  // Per datasheet: Available in Idle mode only, 1300ms execution time
+  this->request_idle_configuration_(Sen6xIdleAction::SHT_HEATER);
+}
+
+void Sen6xComponent::run_scheduled_sht_heater_() {
+  if (!std::isnan(this->sht_heater_min_humidity_) &&
+      !(this->ambient_humidity_ >= this->sht_heater_min_humidity_)) {
+    ESP_LOGD(TAG, "Scheduled SHT Heater skipped (RH %.1f%% < %.1f%%)",
+             this->ambient_humidity_, this->sht_heater_min_humidity_);
+    return;
+  }
+  this->activate_sht_heater();
+}
+
+void Sen6xComponent::poll_sht_heater_() {
+  this->queue_read_(
+      SEN6X_CMD_GET_SHT_HEATER_MEASUREMENTS, 2,
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok || words < 2) {
+          // Older firmware without the readback: the heater has finished
+          // with the activation's execution time
+          ESP_LOGW(TAG, "SHT Heater result not available");
+          this->finish_sht_heater_(NAN, NAN);
+          return;
+        }
+        if (data[0] == 0x7FFF || data[1] == 0x7FFF) {
+          if (++this->sht_heater_polls_ >= SEN6X_SHT_HEATER_POLL_LIMIT) {
+            ESP_LOGW(TAG, "SHT Heater result still pending, giving up");
+            this->finish_sht_heater_(NAN, NAN);
+            return;
+          }
+          this->set_timeout("sht_heater_poll", SEN6X_SHT_HEATER_POLL_MS,
+                            [this]() { this->poll_sht_heater_(); });
+          return;
+        }
+        // RH x100, T x200 (same scaling as the measurement frame)
+        this->finish_sht_heater_((int16_t)data[0] / 100.0f,
+                                 (int16_t)data[1] / 200.0f);
+      });
+}
+
+void Sen6xComponent::finish_sht_heater_(float humidity, float temperature) {
+#ifdef USE_SEN6X_HEATER_SENSORS
+  if (!std::isnan(temperature)) {
+    if (this->heater_humidity_sensor_ != nullptr)
+      this->heater_humidity_sensor_->publish_state(humidity);
+    if (this->heater_temperature_sensor_ != nullptr)
+      this->heater_temperature_sensor_->publish_state(temperature);
+  }
+#endif
+  uint32_t elapsed = millis() - this->sht_heater_activated_ms_;
+  uint32_t remaining = elapsed < SEN6X_SHT_HEATER_COOLDOWN_MS
+                           ? SEN6X_SHT_HEATER_COOLDOWN_MS - elapsed
+                           : 0;
+  ESP_LOGI(TAG,
+           "SHT Heater done (%.2f%% RH, %.2f C) - restarting measurement in "
+           "%u ms",
+           humidity, temperature, (unsigned int)remaining);
+  this->set_timeout("idle_window_close", remaining,
+                    [this]() { this->close_idle_window_(); });
+}
+
+void Sen6xComponent::configure_auto_cleaning_(bool enabled) {
+  // The schedule is driven by tick_fan_runtime_(); a cleaning that is
+  // already overdue runs at the next tick (or quiet period), not at once
+  if (enabled) {
+    ESP_LOGI(TAG,
+             "Enabling Auto Fan Cleaning (every %u h of fan runtime, %u h "
+             "since the last cleaning)",
+             (unsigned int)(this->auto_cleaning_interval_ms_ / 3600000),
+             (unsigned int)(this->cleaning_record_.runtime_s / 3600));
+  } else {
+    ESP_LOGI(TAG, "Disabling Auto Fan Cleaning");
+    this->cleaning_due_ = false;
+  }
+}
+
+// ========== RUNTIME-BASED AUTO CLEANING ==========
+
+void Sen6xComponent::load_cleaning_record_() {
+  this->cleaning_preference_ =
+      global_preferences->make_preference<Sen6xCleaningRecord>(
+          this->preference_hash_ + SEN6X_CLEANING_PREFERENCE_OFFSET, true);
+  Sen6xCleaningRecord record;
+  if (this->cleaning_preference_.load(&record) &&
+      record.version == SEN6X_CLEANING_VERSION) {
+    this->cleaning_record_ = record;
+    ESP_LOGI(TAG, "Fan runtime since last cleaning: %u h (%u cleanings)",
+             (unsigned int)(record.runtime_s / 3600),
+             (unsigned int)record.cleanings);
+  } else {
+    this->cleaning_record_ = Sen6xCleaningRecord{};
+    this->cleaning_record_.version = SEN6X_CLEANING_VERSION;
+  }
+  this->last_cleaning_save_ms_ = millis();
+}
+
+void Sen6xComponent::save_cleaning_record_() {
+  this->cleaning_record_dirty_ = false;
+  this->last_cleaning_save_ms_ = millis();
+  if (this->cleaning_preference_.save(&this->cleaning_record_))
+    this->record_flash_write_();
+}
+
+bool Sen6xComponent::fan_running_() const {
+  // The fan runs in measurement mode (the cleaning itself is not counted)
+  return this->boot_phase_ == Sen6xBootPhase::READY &&
+         this->breaker_state_ == Sen6xBreakerState::CLOSED &&
+         !this->duty_sleeping_() && !this->idle_window_active_ &&
+         !this->fan_cleaning_active_state_;
+}
+
+void Sen6xComponent::tick_fan_runtime_() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - this->last_runtime_tick_ms_;
+  this->last_runtime_tick_ms_ = now;
+  if (this->fan_running_()) {
+    // The state at the tick stands for the whole tick
+    this->runtime_remainder_ms_ += elapsed;
+    uint32_t seconds = this->runtime_remainder_ms_ / 1000;
+    this->runtime_remainder_ms_ %= 1000;
+    this->cleaning_record_.runtime_s += seconds;
+    this->cleaning_record_.total_runtime_s += seconds;
+    if (seconds > 0)
+      this->cleaning_record_dirty_ = true;
+  }
+  if (this->cleaning_record_dirty_ &&
+      now - this->last_cleaning_save_ms_ >= SEN6X_FAN_RUNTIME_CHECKPOINT_MS)
+    this->save_cleaning_record_();
+  this->check_auto_cleaning_due_();
+}
+
+void Sen6xComponent::check_auto_cleaning_due_() {
+  if (!this->config_.auto_cleaning || this->fan_cleaning_active_state_)
+    return;
+  if ((uint64_t)this->cleaning_record_.runtime_s * 1000 <
+      this->auto_cleaning_interval_ms_)
+    return;
+
+  uint32_t now = millis();
+  if (!this->cleaning_due_) {
+    this->cleaning_due_ = true;
+    this->cleaning_due_since_ms_ = now;
+    ESP_LOGI(TAG, "Auto fan cleaning due (%u h of fan runtime)",
+             (unsigned int)(this->cleaning_record_.runtime_s / 3600));
+  }
+  const char *reason = nullptr;
+  if (!this->auto_cleaning_quiet_now_(&reason)) {
+    if (now - this->cleaning_due_since_ms_ < this->quiet_max_delay_ms_)
+      return;
+    reason = "max_delay reached";
+  }
+  ESP_LOGI(TAG, "Triggering Scheduled Auto Fan Cleaning (%s)", reason);
+  this->start_fan_cleaning_();
+}
+
+bool Sen6xComponent::auto_cleaning_quiet_now_(const char **reason) {
+  bool policy = !std::isnan(this->quiet_max_pm_stddev_);
+#ifdef USE_SEN6X_CLEANING_CLOCK
+  if (this->quiet_clock_ != nullptr) {
+    policy = true;
+    ESPTime time = this->quiet_clock_->now();
+    if (time.is_valid()) {
+      uint16_t minute = time.hour * 60 + time.minute;
+      bool inside =
+          this->quiet_window_start_ <= this->quiet_window_end_
+              ? minute >= this->quiet_window_start_ &&
+                    minute < this->quiet_window_end_
+              : minute >= this->quiet_window_start_ ||
+                    minute < this->quiet_window_end_;
+      if (inside) {
+        *reason = "quiet window";
+        return true;
+      }
+    }
+  }
+#endif
+  if (!policy) {
+    *reason = "interval";
+    return true;
+  }
+  float stddev = this->quiet_detector_.stddev();
+  if (!std::isnan(this->quiet_max_pm_stddev_) && !std::isnan(stddev) &&
+      stddev <= this->quiet_max_pm_stddev_) {
+    *reason = "steady PM2.5";
+    return true;
+  }
+  return false;
+}
+
+// Returns the model-specific Read Measured Values command
+// Each SEN6x model has its own I2C command (Datasheet v0.92 Table 26)
+uint16_t Sen6xComponent::get_measurement_command_() {
+#ifdef SEN6X_PINNED_MODEL
+  return Sen6xModelTraits<SEN6X_PINNED_MODEL>::READ_COMMAND;
+#else
+  switch (this->model_) {
+  case Sen6xModel::SEN62:
+    return Sen6xModelTraits<Sen6xModel::SEN62>::READ_COMMAND;
+  case Sen6xModel::SEN63C:
+    return Sen6xModelTraits<Sen6xModel::SEN63C>::READ_COMMAND;
+  case Sen6xModel::SEN65:
+    return Sen6xModelTraits<Sen6xModel::SEN65>::READ_COMMAND;
+  case Sen6xModel::SEN68:
+    return Sen6xModelTraits<Sen6xModel::SEN68>::READ_COMMAND;
+  case Sen6xModel::SEN69C:
+    return Sen6xModelTraits<Sen6xModel::SEN69C>::READ_COMMAND;
+  case Sen6xModel::SEN66:
+  default:
+    return Sen6xModelTraits<Sen6xModel::SEN66>::READ_COMMAND; // Fallback
+  }
+#endif
+}
+
+// Returns the number of data words based on sensor model (Datasheet v0.92)
+uint8_t Sen6xComponent::get_measurement_word_count_() {
+#ifdef SEN6X_PINNED_MODEL
+  return Sen6xModelTraits<SEN6X_PINNED_MODEL>::WORDS;
+#else
+  switch (this->model_) {
+  case Sen6xModel::SEN62:
+    return Sen6xModelTraits<Sen6xModel::SEN62>::WORDS; // PM1-10,RH,T
+  case Sen6xModel::SEN63C:
+    return Sen6xModelTraits<Sen6xModel::SEN63C>::WORDS; // + CO2
+  case Sen6xModel::SEN65:
+    return Sen6xModelTraits<Sen6xModel::SEN65>::WORDS; // + VOC,NOx
+  case Sen6xModel::SEN68:
+    return Sen6xModelTraits<Sen6xModel::SEN68>::WORDS; // + VOC,NOx,HCHO
+  case Sen6xModel::SEN69C:
+    return Sen6xModelTraits<Sen6xModel::SEN69C>::WORDS; // + VOC,NOx,HCHO,CO2
+  case Sen6xModel::SEN66:
+  default:
+    return Sen6xModelTraits<Sen6xModel::SEN66>::WORDS; // + VOC,NOx,CO2
+  }
+#endif
+}
+
+// ========== I2C / UPDATE INSTRUMENTATION ==========
+
+i2c::ErrorCode Sen6xComponent::bus_write_(uint16_t command,
+                                          const uint8_t *data, size_t len) {
+#ifdef USE_SEN6X_DIAGNOSTICS
+  uint32_t start = micros();
+  i2c::ErrorCode result = this->write(data, len);
+  this->diagnostics_.record_transfer(command, true, result, micros() - start);
+  return result;
+#else
+  return this->write(data, len);
+#endif
+}
+
+i2c::ErrorCode Sen6xComponent::bus_read_(uint16_t command, uint8_t *data,
+                                         size_t len) {
+#ifdef USE_SEN6X_DIAGNOSTICS
+  uint32_t start = micros();
+  i2c::ErrorCode result = this->read(data, len);
+  this->diagnostics_.record_transfer(command, false, result, micros() - start);
+  return result;
+#else
+  return this->read(data, len);
+#endif
+}
+
+#ifdef USE_SEN6X_DIAGNOSTICS
+Sen6xCommandStats *Sen6xDiagnostics::command_stats_(uint16_t command) {
+  for (uint8_t i = 0; i < this->command_count_; i++) {
+    if (this->commands_[i].command == command)
+      return &this->commands_[i];
+  }
+  if (this->command_count_ < SEN6X_DIAGNOSTICS_MAX_COMMANDS) {
+    Sen6xCommandStats &stats = this->commands_[this->command_count_++];
+    stats.command = command;
+    return &stats;
+  }
+  return nullptr; // Table full: only the totals count this command
+}
+
+void Sen6xDiagnostics::record_transfer(uint16_t command, bool is_write,
+                                       i2c::ErrorCode result,
+                                       uint32_t duration_us) {
+  Sen6xCommandStats *stats = this->command_stats_(command);
+  this->bus_time_us_ += duration_us;
+  if (is_write) {
+    this->transactions_++;
+    if (stats != nullptr)
+      stats->transactions++;
+  }
+  if (result == i2c::ERROR_NOT_ACKNOWLEDGED) {
+    this->nacks_++;
+    if (stats != nullptr)
+      stats->nacks++;
+  }
+}
+
+void Sen6xDiagnostics::record_crc_error(uint16_t command) {
+  Sen6xCommandStats *stats = this->command_stats_(command);
+  this->crc_errors_++;
+  if (stats != nullptr)
+    stats->crc_errors++;
+}
+
+void Sen6xDiagnostics::record_bus_stats(uint16_t command,
+                                        const Sen6xBusStats &stats) {
+  if (stats.transactions == 0)
+    return;
+  Sen6xCommandStats *command_stats = this->command_stats_(command);
+  this->bus_time_us_ += stats.bus_time_us;
+  this->transactions_ += stats.transactions;
+  this->nacks_ += stats.nacks;
+  this->crc_errors_ += stats.crc_errors;
+  if (command_stats != nullptr) {
+    command_stats->transactions += stats.transactions;
+    command_stats->nacks += stats.nacks;
+    command_stats->crc_errors += stats.crc_errors;
+  }
+}
+
+void Sen6xDiagnostics::record_update_time(uint32_t duration_us) {
+  if (this->update_count_ == 0 || duration_us < this->update_min_us_)
+    this->update_min_us_ = duration_us;
+  if (this->update_count_ == 0 || duration_us > this->update_max_us_)
+    this->update_max_us_ = duration_us;
+  this->update_sum_us_ += duration_us;
+  this->update_count_++;
+}
+
+void Sen6xDiagnostics::publish_(Sen6xDiagnosticSensor id, float value) {
+  sensor::Sensor *sens = this->sensors_[static_cast<uint8_t>(id)];
+  if (sens != nullptr)
+    sens->publish_state(value);
+}
+
+void Sen6xDiagnostics::publish() {
+  this->publish_(Sen6xDiagnosticSensor::I2C_TRANSACTIONS, this->transactions_);
+  this->publish_(Sen6xDiagnosticSensor::I2C_NACKS, this->nacks_);
+  this->publish_(Sen6xDiagnosticSensor::I2C_CRC_ERRORS, this->crc_errors_);
+  this->publish_(Sen6xDiagnosticSensor::I2C_BUS_TIME,
+                 this->bus_time_us_ / 1000.0f);
+  if (this->update_count_ > 0) {
+    this->publish_(Sen6xDiagnosticSensor::UPDATE_TIME_MIN,
+                   this->update_min_us_);
+    this->publish_(Sen6xDiagnosticSensor::UPDATE_TIME_AVG,
+                   (float)this->update_sum_us_ / this->update_count_);
+    this->publish_(Sen6xDiagnosticSensor::UPDATE_TIME_MAX,
+                   this->update_max_us_);
+  }
+  // Skip counters follow Sen6xSkipReason order
+  const uint8_t first_skip =
+      static_cast<uint8_t>(Sen6xDiagnosticSensor::SKIPPED_FAN_CLEANING);
+  for (uint8_t i = 0; i < static_cast<uint8_t>(Sen6xSkipReason::COUNT); i++) {
+    this->publish_(static_cast<Sen6xDiagnosticSensor>(first_skip + i),
+                   this->skips_[i]);
+  }
+
+  for (uint8_t i = 0; i < this->command_count_; i++) {
+    const Sen6xCommandStats &stats = this->commands_[i];
+    ESP_LOGV(TAG, "Command 0x%04X: %u transactions, %u NACKs, %u CRC errors",
+             stats.command, (unsigned int)stats.transactions,
+             (unsigned int)stats.nacks, (unsigned int)stats.crc_errors);
+  }
+
+  // Start the next interval
+  this->bus_time_us_ = 0;
+  this->update_count_ = 0;
+  this->update_sum_us_ = 0;
+}
+#endif
+
+// ========== DUTY-CYCLED MEASUREMENT ==========
+// One sample per period. Measurement starts, the poller reads at
+// update_interval until a frame is stable (every consumed channel valid and
+// past its warm-up), then measurement and the poller stop until the next
+// period. Without USE_SEN6X_DUTY_CYCLE the state stays CONTINUOUS.
+
+void Sen6xComponent::end_measurement_cycle_() {
+  this->measurement_cycle_active_ = false;
+  this->publish_telemetry_();
+  if (this->duty_state_ == Sen6xDutyState::AWAKE && this->duty_frame_stable_)
+    this->enter_duty_sleep_();
+}
+
+void Sen6xComponent::resume_measurement_() {
+  // While sleeping the next wake-up starts measurement
+  if (!this->duty_sleeping_())
+    this->start_measurement_();
+}
+
+#ifdef USE_SEN6X_DUTY_CYCLE
+static Sen6xWarmUpGroup sen6x_warm_up_group(Sen6xChannel channel) {
+  switch (channel) {
+  case Sen6xChannel::HUMIDITY:
+  case Sen6xChannel::TEMPERATURE:
+    return Sen6xWarmUpGroup::RHT;
+  case Sen6xChannel::VOC_INDEX:
+  case Sen6xChannel::NOX_INDEX:
+  case Sen6xChannel::TVOC_WELL:
+  case Sen6xChannel::TVOC_RESET:
+  case Sen6xChannel::TVOC_ETHANOL:
+    return Sen6xWarmUpGroup::GAS;
+  case Sen6xChannel::CO2:
+    return Sen6xWarmUpGroup::CO2;
+  case Sen6xChannel::FORMALDEHYDE:
+    return Sen6xWarmUpGroup::FORMALDEHYDE;
+  default:
+    return Sen6xWarmUpGroup::PM; // PM and Number Concentration
+  }
+}
+
+bool Sen6xComponent::duty_channel_warm_(Sen6xChannel channel) const {
+  if (this->duty_state_ == Sen6xDutyState::CONTINUOUS)
+    return true;
+  if (this->duty_state_ == Sen6xDutyState::SLEEPING)
+    return false; // Late response after the stop
+  uint32_t warm_up =
+      this->warm_up_ms_[static_cast<uint8_t>(sen6x_warm_up_group(channel))];
+  return millis() - this->duty_wake_ms_ >= warm_up;
+}
+#endif
+
+void Sen6xComponent::begin_duty_cycle_() {
+#ifdef USE_SEN6X_DUTY_CYCLE
+  if (this->duty_period_ms_ == 0)
+    return;
+  // The boot sequence started measurement; the first period begins now
+  this->duty_state_ = Sen6xDutyState::AWAKE;
+  this->duty_wake_ms_ = millis();
+  this->duty_frame_stable_ = false;
+  uint32_t longest = *std::max_element(
+      this->warm_up_ms_,
+      this->warm_up_ms_ + static_cast<uint8_t>(Sen6xWarmUpGroup::COUNT));
+  this->set_timeout(
+      "duty_awake_limit", longest + SEN6X_DUTY_STABLE_TIMEOUT_MS, [this]() {
+        ESP_LOGW(TAG, "No stable frame within the awake limit, sleeping");
+        // Let a cycle in flight finish before stopping the sensor
+        if (this->measurement_cycle_active_) {
+          this->duty_frame_stable_ = true;
+        } else {
+          this->enter_duty_sleep_();
+        }
+      });
+#endif
+}
+
+void Sen6xComponent::enter_duty_sleep_() {
+#ifdef USE_SEN6X_DUTY_CYCLE
+  this->cancel_timeout("duty_awake_limit");
+  this->duty_state_ = Sen6xDutyState::SLEEPING;
+  this->duty_frame_stable_ = false;
+  this->duty_last_awake_ms_ = millis() - this->duty_wake_ms_;
+  this->stop_poller();
+  this->stop_measurement_(
+      [](bool ok, const uint16_t *data, uint8_t words) {
+        if (!ok)
+          ESP_LOGW(TAG, "Failed to stop measurement for duty cycle sleep");
+      });
+
+  uint32_t sleep_ms = this->duty_last_awake_ms_ < this->duty_period_ms_
+                          ? this->duty_period_ms_ - this->duty_last_awake_ms_
+                          : 0;
+  ESP_LOGD(TAG, "Duty cycle: awake %u ms, sleeping %u ms",
+           (unsigned int)this->duty_last_awake_ms_, (unsigned int)sleep_ms);
+  this->set_timeout("duty_wake", sleep_ms,
+                    [this]() { this->wake_duty_cycle_(); });
+#endif
+}
+
+void Sen6xComponent::wake_duty_cycle_() {
+#ifdef USE_SEN6X_DUTY_CYCLE
+  if (this->fan_cleaning_active_state_ || this->idle_window_active_) {
+    this->set_timeout("duty_wake", SEN6X_DUTY_RETRY_MS,
+                      [this]() { this->wake_duty_cycle_(); });
+    return;
+  }
+
+#ifdef USE_SEN6X_DUTY_RATIO
+  // Achieved ratio of the period that just ended
+  uint32_t period = millis() - this->duty_wake_ms_;
+  if (this->duty_ratio_sensor_ != nullptr && period > 0)
+    this->duty_ratio_sensor_->publish_state(
+        100.0f * (float)this->duty_last_awake_ms_ / (float)period);
+#endif
+
+  this->start_measurement_();
+  this->begin_duty_cycle_();
+  // Nothing can publish before the first sample and the shortest warm-up
+  uint32_t shortest = *std::min_element(
+      this->warm_up_ms_,
+      this->warm_up_ms_ + static_cast<uint8_t>(Sen6xWarmUpGroup::COUNT));
+  this->set_timeout("duty_poll",
+                    std::max<uint32_t>(shortest, SEN6X_MEASUREMENT_PERIOD_MS),
+                    [this]() { this->start_poller(); });
+#endif
+}
+
+// ========== SENSOR TASK (ESP32) ==========
+// update() only records which reads are due; loop() hands the request to
+// the pinned task once the transaction queue is idle. The task does the
+// blocking I2C work (including waiting for data-ready, which the main loop
+// can't afford) and pushes raw CRC-checked words into the SPSC ring. The
+// main loop drains the ring and decodes through replay_response(), so
+// filters, aggregation and publishing stay single-threaded.
+
+#ifdef USE_SEN6X_SENSOR_TASK
+void Sen6xComponent::request_task_cycle_() {
+  uint32_t reads = 0;
+  if (this->status_poll_due_())
+    reads |= SEN6X_TASK_READ_STATUS;
+  if (this->poll_group_due_(Sen6xPollGroup::READBACK))
+    this->read_device_configuration_();
+  if (this->poll_group_due_(Sen6xPollGroup::NUMBER_CONCENTRATION) &&
+      this->number_concentration_wanted_())
+    reads |= SEN6X_TASK_READ_NC;
+  if (this->poll_group_due_(Sen6xPollGroup::FRAME))
+    reads |= SEN6X_TASK_READ_FRAME;
+
+  if (reads == 0) {
+    this->end_measurement_cycle_();
+    return;
+  }
+  this->task_frame_command_ = this->get_measurement_command_();
+  this->task_frame_words_ = this->get_measurement_word_count_();
+  this->task_request_ = reads;
+}
+
+bool Sen6xComponent::service_sensor_task_() {
+  // Load the flag first: once it reads false, every sample of the cycle is
+  // visible to the drain below (release in the task, acquire here)
+  bool busy = this->task_busy_.load(std::memory_order_acquire);
+  this->drain_task_samples_();
+
+  uint32_t dropped = this->task_dropped_samples_.exchange(0);
+  if (dropped > 0)
+    ESP_LOGW(TAG, "Sensor task ring full, %u samples dropped",
+             (unsigned int)dropped);
+
+  if (this->task_cycle_in_flight_ && !busy) {
+    this->task_cycle_in_flight_ = false;
+    this->end_measurement_cycle_();
+  }
+  if (busy)
+    return true;
+
+  if (this->task_request_ == 0 ||
+      this->transaction_state_ != TransactionState::IDLE)
+    return false;
+  if (this->fan_cleaning_active_state_ || this->idle_window_active_) {
+    // Same guard as read_measurement_data_(): drop the cycle
+    this->diagnostics_.record_skip(this->fan_cleaning_active_state_
+                                       ? Sen6xSkipReason::FAN_CLEANING
+                                       : Sen6xSkipReason::IDLE_WINDOW);
+    this->task_request_ = 0;
+    this->end_measurement_cycle_();
+    return false;
+  }
+
+  this->task_busy_.store(true, std::memory_order_relaxed);
+  this->task_cycle_in_flight_ = true;
+  xTaskNotify(this->sensor_task_, this->task_request_,
+              eSetValueWithOverwrite);
+  this->task_request_ = 0;
+  return true;
+}
+
+void Sen6xComponent::drain_task_samples_() {
+  Sen6xTaskSample sample;
+  while (this->task_samples_.pop(sample)) {
+    this->diagnostics_.record_bus_stats(SEN6X_CMD_GET_DATA_READY,
+                                        sample.probe);
+    this->diagnostics_.record_bus_stats(sample.command, sample.bus);
+    if (sample.result != Sen6xTaskResult::OK) {
+      ESP_LOGW(TAG, "%s reading command 0x%04X (sensor task)",
+               sample.result == Sen6xTaskResult::CRC_ERROR ? "CRC Error"
+                                                           : "I2C failure",
+               sample.command);
+      this->error_code_ = sample.result == Sen6xTaskResult::CRC_ERROR
+                              ? CRC_CHECK_FAILED
+                              : COMMUNICATION_FAILED;
+      this->record_bus_result_(false);
+      continue;
+    }
+    this->error_code_ = NONE;
+    this->record_bus_result_(true);
+    if (sample.command == SEN6X_CMD_GET_DATA_READY) {
+      ESP_LOGD(TAG, "Data not ready yet, skipping measurement");
+      this->diagnostics_.record_skip(Sen6xSkipReason::DATA_NOT_READY);
+      continue;
+    }
+    this->capture_(sample.command, sample.data, sample.words,
+                   sample.timestamp_ms);
+    this->replay_response(sample.command, sample.data, sample.words);
+  }
+}
+
+void Sen6xComponent::sensor_task_entry_(void *arg) {
+  static_cast<Sen6xComponent *>(arg)->sensor_task_loop_();
+}
+
+void Sen6xComponent::sensor_task_loop_() {
+  uint16_t data[SEN6X_MAX_RESPONSE_WORDS];
+  while (true) {
+    uint32_t reads = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &reads, portMAX_DELAY);
+
+    if (reads & SEN6X_TASK_READ_STATUS) {
+      Sen6xBusStats bus{};
+      Sen6xTaskResult result =
+          this->task_read_(SEN6X_CMD_GET_STATUS, data, 2, bus);
+      this->push_task_sample_(SEN6X_CMD_GET_STATUS, result, data, 2, bus);
+    }
+
+    if (reads & SEN6X_TASK_READ_FRAME) {
+      // Blocking is free here, so wait for new data instead of skipping the
+      // cycle (same probe budget as phase acquisition)
+      Sen6xBusStats probe{};
+      Sen6xTaskResult result = Sen6xTaskResult::OK;
+      bool ready = false;
+      for (uint8_t attempt = 0; attempt < SEN6X_PHASE_MAX_PROBES; attempt++) {
+        if (attempt > 0)
+          vTaskDelay(pdMS_TO_TICKS(SEN6X_PHASE_PROBE_INTERVAL_MS));
+        result = this->task_read_(SEN6X_CMD_GET_DATA_READY, data, 1, probe);
+        ready = result == Sen6xTaskResult::OK && (data[0] & 0x00FF) != 0;
+        if (ready || result != Sen6xTaskResult::OK)
+          break;
+      }
+      if (ready) {
+        Sen6xBusStats bus{};
+        result = this->task_read_(this->task_frame_command_, data,
+                                  this->task_frame_words_, bus);
+        this->push_task_sample_(this->task_frame_command_, result, data,
+                                this->task_frame_words_, bus, probe);
+      } else {
+        this->push_task_sample_(SEN6X_CMD_GET_DATA_READY, result, data, 0,
+                                probe);
+      }
+      // Number Concentration is chained after a successful frame
+      if (!ready || result != Sen6xTaskResult::OK)
+        reads &= ~SEN6X_TASK_READ_NC;
+    }
+
+    if (reads & SEN6X_TASK_READ_NC) {
+      Sen6xBusStats bus{};
+      Sen6xTaskResult result =
+          this->task_read_(SEN6X_CMD_NUMBER_CONCENTRATION, data, 5, bus);
+      this->push_task_sample_(SEN6X_CMD_NUMBER_CONCENTRATION, result, data,
+                              5, bus);
+    }
 
-  int idx = 2;
-  for (int i = 0; i < 4; i++) {
-    buffer[idx++] = (payload[i] >> 8) & 0xFF;
-    buffer[idx++] = payload[i] & 0xFF;
-    uint8_t crc_data[2] = {buffer[idx - 2], buffer[idx - 1]};
-    buffer[idx++] = sen6x_crc(crc_data, 2);
+    this->task_busy_.store(false, std::memory_order_release);
   }
+}
+
+// One raw transfer of a task read, counted into 'stats'
+static i2c::ErrorCode sen6x_count_transfer(Sen6xBusStats &stats,
+                                           i2c::ErrorCode result,
+                                           uint32_t start_us) {
+  stats.bus_time_us += micros() - start_us;
+  if (result == i2c::ERROR_NOT_ACKNOWLEDGED)
+    stats.nacks++;
+  return result;
+}
+
+Sen6xTaskResult Sen6xComponent::task_read_(uint16_t command, uint16_t *data,
+                                           uint8_t words,
+                                           Sen6xBusStats &stats) {
+  uint8_t raw_buffer[SEN6X_MAX_RESPONSE_WORDS * 3];
+  raw_buffer[0] = (command >> 8) & 0xFF;
+  raw_buffer[1] = command & 0xFF;
+  stats.transactions++;
+  uint32_t start = micros();
+  if (sen6x_count_transfer(stats, this->write(raw_buffer, 2), start) !=
+      i2c::ERROR_OK)
+    return Sen6xTaskResult::BUS_ERROR;
+
+  // +1 tick: the first tick may be partial
+  vTaskDelay(pdMS_TO_TICKS(SEN6X_DEFAULT_EXECUTION_TIME_MS) + 1);
+
+  start = micros();
+  if (sen6x_count_transfer(stats, this->read(raw_buffer, words * 3), start) !=
+      i2c::ERROR_OK)
+    return Sen6xTaskResult::BUS_ERROR;
+  if (sen6x_unpack_frame(raw_buffer, words, data) >= 0) {
+    stats.crc_errors++;
+    return Sen6xTaskResult::CRC_ERROR;
+  }
+  return Sen6xTaskResult::OK;
+}
+
+void Sen6xComponent::push_task_sample_(uint16_t command,
+                                       Sen6xTaskResult result,
+                                       const uint16_t *data, uint8_t words,
+                                       const Sen6xBusStats &bus,
+                                       const Sen6xBusStats &probe) {
+  Sen6xTaskSample sample;
+  sample.timestamp_ms = millis();
+  sample.command = command;
+  sample.result = result;
+  sample.bus = bus;
+  sample.probe = probe;
+  sample.words = result == Sen6xTaskResult::OK ? words : 0;
+  if (sample.words > 0)
+    memcpy(sample.data, data, sample.words * sizeof(uint16_t));
+  if (!this->task_samples_.push(sample))
+    this->task_dropped_samples_.fetch_add(1, std::memory_order_relaxed);
+}
+#endif
 
-  if (this->write(buffer, sizeof(buffer)) == i2c::ERROR_OK) {
-    ESP_LOGI(TAG, "Temperature Offset written to slot %d", slot);
-    if (this->temperature_offset_preference_.save(&offset)) {
-      ESP_LOGD(TAG, "Persisted to flash");
+// ========== ROLLING AVERAGES ==========
+// Bucketed window means (see sen6x_rolling.h) for building-standard limits
+// judged on 8 h / 24 h averages. Each window is checkpointed to its own
+// serial-keyed preference every SEN6X_ROLLING_CHECKPOINT_INTERVAL_MS and on
+// shutdown, so a reboot resumes the window instead of restarting it.
+
+void Sen6xComponent::add_rolling_average(Sen6xChannel channel,
+                                         sensor::Sensor *sens,
+                                         uint32_t window_ms, uint8_t buckets) {
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  for (Sen6xRollingAverage &average : this->rolling_averages_) {
+    if (average.channel == Sen6xChannel::COUNT ||
+        average.channel == channel) {
+      average.channel = channel;
+      average.sensor = sens;
+      average.mean.configure(window_ms, buckets);
+      return;
     }
-    return true;
   }
-  ESP_LOGW(TAG, "Failed to write Temperature Offset");
-  return false;
+  ESP_LOGW(TAG, "More than %u rolling averages, ignoring channel %u",
+           SEN6X_MAX_ROLLING_AVERAGES, (unsigned int)channel);
+#endif
 }
 
-bool Sen6xComponent::write_temperature_compensation_(
-    const TemperatureCompensation &compensation) {
-  // Datasheet 4.8.14: Requires 4 words (12 bytes of data)
-  // Word 0: Offset (int16, scaled * 200)
-  // Word 1: Slope (int16, scaled * 10000)
-  // Word 2: Time Constant (uint16, seconds)
-  // Word 3: Slot (uint16, MUST be 0-4) -> Use slot 0 (base self-heating)
-
-  ESP_LOGD(TAG, "Writing Temp Compensation: offset=%d, slope=%d, time=%d",
-           compensation.offset, compensation.normalized_offset_slope,
-           compensation.time_constant);
+void Sen6xComponent::feed_rolling_average_(Sen6xChannel channel,
+                                           float value) {
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  for (Sen6xRollingAverage &average : this->rolling_averages_) {
+    if (average.channel != channel)
+      continue;
+    // Publish once per closed bucket; the open one is still filling
+    if (average.mean.add(value, millis()))
+      average.sensor->publish_state(average.mean.mean());
+    return;
+  }
+#endif
+}
 
-  uint16_t payload[4] = {
-      (uint16_t)compensation.offset,
-      (uint16_t)compensation.normalized_offset_slope,
-      compensation.time_constant,
-      0 // Slot 0
-  };
+void Sen6xComponent::load_rolling_averages_() {
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  uint32_t now = millis();
+  bool any = false;
+  for (Sen6xRollingAverage &average : this->rolling_averages_) {
+    if (average.channel == Sen6xChannel::COUNT)
+      continue;
+    any = true;
+    average.preference =
+        global_preferences->make_preference<Sen6xRollingCheckpoint>(
+            this->preference_hash_ + SEN6X_ROLLING_PREFERENCE_OFFSET +
+                static_cast<uint32_t>(average.channel),
+            true);
+    Sen6xRollingCheckpoint checkpoint;
+    if (average.preference.load(&checkpoint) &&
+        average.mean.restore(checkpoint, now)) {
+      float mean = average.mean.mean();
+      ESP_LOGI(TAG, "Restored rolling average of channel %u: %.1f",
+               (unsigned int)average.channel, mean);
+      if (!std::isnan(mean))
+        average.sensor->publish_state(mean);
+    } else {
+      average.mean.start(now);
+    }
+  }
+  if (any)
+    this->set_interval("rolling_checkpoint",
+                       SEN6X_ROLLING_CHECKPOINT_INTERVAL_MS,
+                       [this]() { this->save_rolling_averages_(); });
+#endif
+}
 
-  uint8_t buffer[2 + (4 * 3)]; // Cmd (2) + 4 words * (2 data + 1 CRC)
-  buffer[0] = 0x60;
-  buffer[1] = 0xB2;
+void Sen6xComponent::save_rolling_averages_() {
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  if (this->preference_hash_ == 0)
+    return; // Not loaded yet (serial unknown); nothing to checkpoint
+  uint32_t now = millis();
+  for (Sen6xRollingAverage &average : this->rolling_averages_) {
+    if (average.channel == Sen6xChannel::COUNT)
+      continue;
+    // Age out buckets of channels that stopped reporting
+    if (average.mean.advance(now))
+      average.sensor->publish_state(average.mean.mean());
+    Sen6xRollingCheckpoint checkpoint;
+    average.mean.save(checkpoint, now);
+    if (average.preference.save(&checkpoint))
+      this->record_flash_write_();
+    else
+      ESP_LOGW(TAG, "Could not save rolling average of channel %u",
+               (unsigned int)average.channel);
+  }
+#endif
+}
 
-  int idx = 2;
-  for (int i = 0; i < 4; i++) {
-    buffer[idx++] = (payload[i] >> 8) & 0xFF;
-    buffer[idx++] = payload[i] & 0xFF;
-    uint8_t crc_data[2] = {buffer[idx - 2], buffer[idx - 1]};
-    buffer[idx++] = sen6x_crc(crc_data, 2);
+// ========== BURST SAMPLING ==========
+// Steady state polls at update_interval. A step on a trigger channel (or the
+// switch/action) switches the poller to burst_interval for burst_duration;
+// every further trigger restarts the duration.
+
+void Sen6xComponent::add_burst_trigger(Sen6xChannel channel, float step) {
+#ifdef USE_SEN6X_BURST
+  for (Sen6xBurstTrigger &trigger : this->burst_triggers_) {
+    if (trigger.channel == Sen6xChannel::COUNT ||
+        trigger.channel == channel) {
+      trigger.channel = channel;
+      trigger.step = step;
+      return;
+    }
   }
+  ESP_LOGW(TAG, "More than %u burst triggers, ignoring channel %u",
+           SEN6X_MAX_BURST_TRIGGERS, (unsigned int)channel);
+#endif
+}
 
-  if (this->write(buffer, sizeof(buffer)) == i2c::ERROR_OK) {
-    ESP_LOGI(TAG,
-             "Temperature Compensation written (offset=%.2f°C, slope=%.4f, "
-             "time=%ds)",
-             compensation.offset / 200.0f,
-             compensation.normalized_offset_slope / 10000.0f,
-             compensation.time_constant);
-    return true;
+void Sen6xComponent::check_burst_triggers_(Sen6xChannel channel,
+                                           uint16_t raw) {
+#ifdef USE_SEN6X_BURST
+  for (Sen6xBurstTrigger &trigger : this->burst_triggers_) {
+    if (trigger.channel != channel)
+      continue;
+    float value = sen6x_channel_value(
+        channel, SEN6X_CHANNEL_SCALES[static_cast<uint8_t>(channel)].is_signed
+                     ? (float)(int16_t)raw
+                     : (float)raw);
+    bool stepped = !std::isnan(trigger.last_value) &&
+                   std::fabs(value - trigger.last_value) >= trigger.step;
+    if (stepped) {
+      ESP_LOGD(TAG, "Burst trigger: channel %u %.1f -> %.1f",
+               (unsigned int)channel, trigger.last_value, value);
+      this->start_burst();
+    }
+    trigger.last_value = value;
+    return;
   }
-  ESP_LOGW(TAG, "Failed to write Temperature Compensation");
-  return false;
+#endif
 }
 
-bool Sen6xComponent::write_voc_algorithm_tuning_(const GasTuning &tuning) {
-  // Command 0x60D0: Set VOC Algorithm Tuning Parameters
-  // Payload: 6 words (12 bytes)
-  uint16_t payload[6];
-  payload[0] = tuning.index_offset;
-  payload[1] = tuning.learning_time_offset_hours; // 12 default, 720 for WELL
-  payload[2] = tuning.learning_time_gain_hours;
-  payload[3] = tuning.gating_max_duration_minutes;
-  payload[4] = tuning.std_initial;
-  payload[5] = tuning.gain_factor;
+void Sen6xComponent::start_burst(uint32_t duration_ms) {
+#ifdef USE_SEN6X_BURST
+  if (duration_ms == 0)
+    duration_ms = this->burst_duration_ms_;
+  // (Re)arming the end timer extends a running burst
+  this->set_timeout("burst", duration_ms, [this]() { this->stop_burst(); });
+  if (this->burst_active_)
+    return;
+  this->burst_active_ = true;
+  ESP_LOGI(TAG, "Burst sampling started: every %u ms for %u s",
+           (unsigned int)this->burst_interval_ms_,
+           (unsigned int)(duration_ms / 1000));
+  // Never slower than the baseline
+  this->set_effective_update_interval_(
+      std::min(this->burst_interval_ms_, this->baseline_update_interval_ms_));
+#ifdef USE_SEN6X_SWITCH
+  if (this->burst_switch_ != nullptr)
+    this->burst_switch_->publish_state(true);
+#endif
+#else
+  ESP_LOGW(TAG, "Burst sampling not enabled (set 'burst:' in YAML)");
+#endif
+}
 
-  ESP_LOGD(
-      TAG,
-      "VOC Tuning: idx=%d, offset=%dh, gain=%dh, gating=%dm, std=%d, factor=%d",
-      payload[0], payload[1], payload[2], payload[3], payload[4], payload[5]);
+void Sen6xComponent::stop_burst() {
+#ifdef USE_SEN6X_BURST
+  if (!this->burst_active_)
+    return;
+  this->cancel_timeout("burst");
+  this->burst_active_ = false;
+  ESP_LOGI(TAG, "Burst sampling ended, back to %u ms",
+           (unsigned int)this->baseline_update_interval_ms_);
+  this->set_effective_update_interval_(this->baseline_update_interval_ms_);
+#ifdef USE_SEN6X_SWITCH
+  if (this->burst_switch_ != nullptr)
+    this->burst_switch_->publish_state(false);
+#endif
+#endif
+}
 
-  uint8_t buffer[2 + (6 * 3)]; // Cmd (2) + 6 words * (2 data + 1 CRC)
-  buffer[0] = 0x60;
-  buffer[1] = 0xD0;
+void Sen6xComponent::set_effective_update_interval_(uint32_t interval_ms) {
+  this->set_update_interval(interval_ms);
+  // Re-arms the "update" interval with the new period
+  this->start_poller();
+}
 
-  int idx = 2;
-  for (int i = 0; i < 6; i++) {
-    buffer[idx++] = (payload[i] >> 8) & 0xFF;
-    buffer[idx++] = payload[i] & 0xFF;
-    uint8_t crc_data[2] = {buffer[idx - 2], buffer[idx - 1]};
-    buffer[idx++] = sen6x_crc(crc_data, 2);
+// ========== PACKED TELEMETRY ==========
+
+// decode_frame_() stores frame channels by their Sen6xChannel index
+static_assert(static_cast<uint8_t>(Sen6xChannel::FORMALDEHYDE) ==
+                  static_cast<uint8_t>(Sen6xTelemetrySlot::FORMALDEHYDE),
+              "Frame channels and telemetry slots must share indices");
+
+#ifdef USE_SEN6X_TELEMETRY
+void Sen6xTelemetry::encode(uint8_t model, uint32_t timestamp_ms,
+                            uint32_t device_status, uint8_t *frame) const {
+  frame[0] = SEN6X_TELEMETRY_VERSION;
+  frame[1] = model;
+  frame[2] = this->sequence_ & 0xFF;
+  frame[3] = this->sequence_ >> 8;
+  for (uint8_t i = 0; i < 4; i++) {
+    frame[4 + i] = (timestamp_ms >> (i * 8)) & 0xFF;
+    frame[8 + i] = (device_status >> (i * 8)) & 0xFF;
+  }
+  frame[12] = this->valid_mask_ & 0xFF;
+  frame[13] = this->valid_mask_ >> 8;
+  for (uint8_t i = 0; i < SEN6X_TELEMETRY_SLOTS; i++) {
+    // Invalid slots are zeroed so equal cycles encode identically
+    uint16_t raw = (this->valid_mask_ & (1U << i)) ? this->slots_[i] : 0;
+    frame[SEN6X_TELEMETRY_HEADER_SIZE + i * 2] = raw & 0xFF;
+    frame[SEN6X_TELEMETRY_HEADER_SIZE + i * 2 + 1] = raw >> 8;
   }
+}
 
-  return this->write(buffer, sizeof(buffer)) == i2c::ERROR_OK;
+void Sen6xTelemetry::publish(uint8_t model, uint32_t timestamp_ms,
+                             uint32_t device_status) {
+  if (!this->pending_ || this->sensor_ == nullptr)
+    return;
+  this->pending_ = false;
+  uint8_t frame[SEN6X_TELEMETRY_FRAME_SIZE];
+  this->encode(model, timestamp_ms, device_status, frame);
+  this->sequence_++;
+  this->sensor_->publish_state(base64_encode(frame, sizeof(frame)));
 }
+#endif
 
-bool Sen6xComponent::write_nox_algorithm_tuning_(const GasTuning &tuning) {
-  // Command 0x60E1: Set NOx Algorithm Tuning Parameters
-  // Payload: 5 words (NOx has no std_initial parameter)
-  uint16_t payload[5];
-  payload[0] = tuning.index_offset;
-  payload[1] = tuning.learning_time_offset_hours; // 12 default, 720 for WELL
-  payload[2] = tuning.learning_time_gain_hours;
-  payload[3] = tuning.gating_max_duration_minutes;
-  payload[4] = tuning.gain_factor;
+// ========== BUS-FAULT CIRCUIT BREAKER ==========
+// CLOSED counts consecutive failed transactions. At the threshold the
+// breaker OPENs: queued work is failed, new transactions are rejected
+// without touching the bus and update() does nothing. After the backoff a
+// Device Status read probes the sensor (HALF_OPEN); failure doubles the
+// backoff up to the maximum, success closes the breaker and re-initializes
+// measurement, since an unplugged sensor comes back idle with its volatile
+// settings lost.
+
+#ifdef USE_SEN6X_TEXT_SENSOR
+static const char *sen6x_breaker_state_name(Sen6xBreakerState state) {
+  switch (state) {
+  case Sen6xBreakerState::OPEN:
+    return "OPEN";
+  case Sen6xBreakerState::HALF_OPEN:
+    return "HALF_OPEN";
+  case Sen6xBreakerState::CLOSED:
+  default:
+    return "CLOSED";
+  }
+}
+#endif
 
-  ESP_LOGD(TAG,
-           "NOx Tuning: idx=%d, offset=%dh, gain=%dh, gating=%dm, factor=%d",
-           payload[0], payload[1], payload[2], payload[3], payload[4]);
+void Sen6xComponent::record_bus_result_(bool ok) {
+  // Boot failures keep their own handling (mark_failed)
+  if (this->boot_phase_ != Sen6xBootPhase::READY)
+    return;
+  if (ok) {
+    this->consecutive_bus_failures_ = 0;
+    return;
+  }
+  // A failed probe is handled by its callback
+  if (this->breaker_state_ != Sen6xBreakerState::CLOSED)
+    return;
+  if (++this->consecutive_bus_failures_ >= this->breaker_threshold_)
+    this->trip_breaker_();
+}
 
-  uint8_t buffer[2 + (5 * 3)];
-  buffer[0] = 0x60;
-  buffer[1] = 0xE1;
+void Sen6xComponent::trip_breaker_() {
+  if (this->breaker_state_ == Sen6xBreakerState::CLOSED) {
+    this->breaker_backoff_ms_ = this->breaker_initial_backoff_ms_;
+    this->breaker_trips_++;
+    ESP_LOGW(TAG,
+             "I2C bus fault: %u consecutive failures, pausing sensor access "
+             "(fault #%u)",
+             (unsigned int)this->consecutive_bus_failures_,
+             (unsigned int)this->breaker_trips_);
+    this->status_set_warning();
+  } else {
+    this->breaker_backoff_ms_ = std::min(this->breaker_backoff_ms_ * 2,
+                                         this->breaker_max_backoff_ms_);
+  }
+  this->breaker_state_ = Sen6xBreakerState::OPEN;
+  this->consecutive_bus_failures_ = 0;
+  this->fail_queued_transactions_();
+  // A pending reapply is redone by the next recovery
+  this->cancel_timeout("reapply_stop");
+  this->reconfigure_active_ = false;
+  // The cycle in flight lost its reads
+  if (this->measurement_cycle_active_)
+    this->end_measurement_cycle_();
+  this->reset_phase_lock_();
+  this->publish_breaker_state_();
+  ESP_LOGD(TAG, "Next bus probe in %u s",
+           (unsigned int)(this->breaker_backoff_ms_ / 1000));
+  this->set_timeout("bus_probe", this->breaker_backoff_ms_,
+                    [this]() { this->probe_bus_(); });
+}
 
-  int idx = 2;
-  for (int i = 0; i < 5; i++) {
-    buffer[idx++] = (payload[i] >> 8) & 0xFF;
-    buffer[idx++] = payload[i] & 0xFF;
-    uint8_t crc_data[2] = {buffer[idx - 2], buffer[idx - 1]};
-    buffer[idx++] = sen6x_crc(crc_data, 2);
+void Sen6xComponent::fail_queued_transactions_() {
+  // A command already written is abandoned with the rest
+  this->transaction_state_ = TransactionState::IDLE;
+  while (this->transaction_count_ > 0) {
+    Sen6xTransactionCallback callback =
+        std::move(this->transaction_queue_[this->transaction_head_].callback);
+    this->transaction_head_ =
+        (this->transaction_head_ + 1) % SEN6X_TRANSACTION_QUEUE_SIZE;
+    this->transaction_count_--;
+    // Follow-ups queued from here are rejected while OPEN
+    if (callback)
+      callback(false, nullptr, 0);
   }
-
-  return this->write(buffer, sizeof(buffer)) == i2c::ERROR_OK;
 }
 
-bool Sen6xComponent::write_rht_acceleration_(const RhtAcceleration &rht) {
-  // Command 0x6100: Set Temperature Acceleration Parameters
-  // Payload: 4 words (K, P, T1, T2)
-  // These are volatile (reset to defaults on power cycle)
-  // Must be called in Idle Mode (before start_measurement)
-  uint16_t payload[4];
-  payload[0] = rht.k;
-  payload[1] = rht.p;
-  payload[2] = rht.t1;
-  payload[3] = rht.t2;
+void Sen6xComponent::probe_bus_() {
+  this->breaker_state_ = Sen6xBreakerState::HALF_OPEN;
+  this->publish_breaker_state_();
+  this->queue_read_(SEN6X_CMD_GET_STATUS, 2,
+                    [this](bool ok, const uint16_t *data, uint8_t words) {
+                      if (ok) {
+                        this->recover_from_bus_fault_();
+                      } else {
+                        this->trip_breaker_();
+                      }
+                    });
+}
 
-  ESP_LOGI(TAG, "RHT Acceleration: K=%d, P=%d, T1=%ds, T2=%ds", payload[0],
-           payload[1], payload[2], payload[3]);
+void Sen6xComponent::recover_from_bus_fault_() {
+  ESP_LOGI(TAG, "I2C bus recovered, re-initializing measurement");
+  this->breaker_state_ = Sen6xBreakerState::CLOSED;
+  this->consecutive_bus_failures_ = 0;
+  this->status_clear_warning();
+  this->publish_breaker_state_();
+  // Failed transactions may have left a window or cleaning half done; end
+  // them before the reapply restarts measurement underneath
+  this->abort_idle_window_();
+  this->abort_fan_cleaning_();
+  this->reapply_volatile_configuration_();
+}
 
-  uint8_t buffer[2 + (4 * 3)]; // Command (2) + 4 words * (2 bytes + 1 CRC)
-  buffer[0] = (SEN6X_CMD_SET_RHT_ACCELERATION >> 8) & 0xFF;
-  buffer[1] = SEN6X_CMD_SET_RHT_ACCELERATION & 0xFF;
+void Sen6xComponent::reapply_volatile_configuration_() {
+  // The sensor may be idle (power cycled) or still measuring (bus glitch);
+  // Stop is accepted in both modes and makes the idle-only writes valid.
+  // Windows, cleaning and resets wait until the writes are queued.
+  this->reconfigure_active_ = true;
+  this->stop_measurement_(
+      [this](bool ok, const uint16_t *data, uint8_t words) {
+        if (ok) {
+          this->apply_volatile_configuration_();
+          return;
+        }
+        // A failed Stop returns at once; the sensor may still be stopping
+        ESP_LOGD(TAG, "Stop measurement not acknowledged, continuing");
+        this->set_timeout("reapply_stop", SEN6X_STOP_MEASUREMENT_TIME_MS,
+                          [this]() { this->apply_volatile_configuration_(); });
+      });
+}
 
-  int idx = 2;
-  for (int i = 0; i < 4; i++) {
-    buffer[idx++] = (payload[i] >> 8) & 0xFF;
-    buffer[idx++] = payload[i] & 0xFF;
-    uint8_t crc_data[2] = {buffer[idx - 2], buffer[idx - 1]};
-    buffer[idx++] = sen6x_crc(crc_data, 2);
+void Sen6xComponent::apply_volatile_configuration_() {
+  this->reconfigure_active_ = false;
+  // Idle-only, lost on power cycle
+  if (this->voc_tuning_.has_value())
+    this->write_voc_algorithm_tuning_(this->voc_tuning_.value());
+  if (this->nox_tuning_.has_value())
+    this->write_nox_algorithm_tuning_(this->nox_tuning_.value());
+  if (this->rht_acceleration_.has_value())
+    this->write_rht_acceleration_(this->rht_acceleration_.value());
+  if (this->store_baseline_)
+    this->restore_voc_baseline_();
+  if (sen6x_model_has_co2(this->model_)) {
+    if (!std::isnan(this->config_.altitude))
+      this->write_altitude_compensation_(this->config_.altitude);
+    this->write_co2_asc_(this->config_.co2_asc);
+  }
+
+  // A duty-cycle sleep keeps the sensor stopped until its wake-up
+  if (!this->duty_sleeping_()) {
+    this->start_measurement_();
+    this->begin_duty_cycle_(); // Restarts the warm-up when duty cycling
   }
 
-  return this->write(buffer, sizeof(buffer)) == i2c::ERROR_OK;
+  // Accepted in both modes
+  if (!std::isnan(this->config_.temperature_offset))
+    this->write_temperature_offset_(this->config_.temperature_offset);
+  if (this->temperature_compensation_.has_value())
+    this->write_temperature_compensation_(
+        this->temperature_compensation_.value());
+  this->last_written_pressure_ = NAN;
+  if (!std::isnan(this->config_.ambient_pressure))
+    this->write_ambient_pressure_compensation_(this->config_.ambient_pressure,
+                                               false);
 }
 
-bool Sen6xComponent::write_co2_asc_(bool enabled) {
-  // Command 0x6711, 2 bytes (Padding + Status) + CRC
-  uint16_t data = enabled ? 0x0001 : 0x0000;
-  return this->write_command_with_data_(0x6711, data);
+void Sen6xComponent::publish_breaker_state_() {
+#ifdef USE_SEN6X_BINARY_SENSOR
+  if (this->bus_fault_binary_sensor_ != nullptr)
+    this->bus_fault_binary_sensor_->publish_state(
+        this->breaker_state_ != Sen6xBreakerState::CLOSED);
+#endif
+#ifdef USE_SEN6X_TEXT_SENSOR
+  if (this->bus_state_text_sensor_ != nullptr)
+    this->bus_state_text_sensor_->publish_state(
+        sen6x_breaker_state_name(this->breaker_state_));
+#endif
 }
 
-bool Sen6xComponent::perform_forced_co2_calibration_(uint16_t reference_ppm) {
-  // Datasheet 4.8.31: Forced CO2 Recalibration
-  // Must be called in Idle Mode (measurement stopped)
-  // Takes ~500ms, reads back correction value
-  // Calibration is PERSISTENT (stored in sensor EEPROM)
+// ========== SHARED BUS SCHEDULER ==========
 
-  ESP_LOGI(TAG, "Executing Forced CO2 Recalibration with reference: %d ppm",
-           reference_ppm);
+void Sen6xComponent::set_bus_time_budget(uint32_t budget_us) {
+  global_sen6x_bus_scheduler.set_budget_us(budget_us);
+}
 
-  // Send command with reference value
-  if (!this->write_command_with_data_(SEN6X_CMD_FORCED_CO2_RECAL,
-                                      reference_ppm)) {
-    ESP_LOGW(TAG, "Failed to send FRC command");
-    return false;
+uint8_t Sen6xBusScheduler::register_device() {
+  if (this->device_count_ >= SEN6X_BUS_SCHEDULER_MAX_DEVICES) {
+    ESP_LOGW(TAG, "More than %u SEN6x instances, extra ones are unscheduled",
+             SEN6X_BUS_SCHEDULER_MAX_DEVICES);
+    return SEN6X_BUS_SCHEDULER_MAX_DEVICES;
   }
+  return this->device_count_++;
+}
 
-  // Wait 500ms for FRC to complete (per datasheet)
-  delay(550);
-
-  // Read correction value (3 bytes: 2 data + 1 CRC)
-  uint16_t correction;
-  if (this->read_words_(SEN6X_CMD_FORCED_CO2_RECAL, &correction, 1)) {
-    if (correction == 0xFFFF) {
-      ESP_LOGW(TAG, "FRC failed - sensor returned error (0xFFFF)");
-      return false;
+void Sen6xBusScheduler::roll_over_() {
+  this->loop_id_++;
+  this->used_us_ = 0;
+  this->priority_pending_ = 0;
+  for (uint8_t i = 0; i < this->device_count_; i++) {
+    if (!this->denied_[i])
+      continue;
+    if (this->denied_loop_[i] + 1 == this->loop_id_) {
+      this->priority_pending_++;
+    } else {
+      // Stopped asking - drop its priority claim
+      this->denied_[i] = false;
     }
+  }
+}
 
-    // Correction value is (returned - 0x8000)
-    int16_t offset = (int16_t)(correction - 0x8000);
-    ESP_LOGI(TAG, "FRC successful! Correction offset: %d ppm (raw: 0x%04X)",
-             offset, correction);
+bool Sen6xBusScheduler::acquire(uint8_t slot) {
+  if (this->budget_us_ == 0 || slot >= SEN6X_BUS_SCHEDULER_MAX_DEVICES)
+    return true;
+
+  bool priority =
+      this->denied_[slot] && this->denied_loop_[slot] + 1 == this->loop_id_;
+  if ((priority || this->priority_pending_ == 0) &&
+      this->used_us_ < this->budget_us_) {
+    if (priority) {
+      this->denied_[slot] = false;
+      this->priority_pending_--;
+    }
     return true;
   }
 
-  ESP_LOGW(TAG, "Failed to read FRC result");
+  // Deferred: served before newcomers in the next loop iteration
+  this->denied_[slot] = true;
+  this->denied_loop_[slot] = this->loop_id_;
   return false;
 }
 
-void Sen6xComponent::configure_auto_cleaning_(bool enabled) {
-  // First cancel any existing interval/timeout
-  this->cancel_interval("auto_clean");
-  this->cancel_timeout("auto_clean_first");
-
-  if (enabled) {
-    uint32_t interval_hours = this->auto_cleaning_interval_ms_ / 3600000;
-    ESP_LOGI(TAG, "Enabling Auto Fan Cleaning (every %u hours)",
-             interval_hours);
-    ESP_LOGI(TAG, "First auto-clean scheduled in %u hours", interval_hours);
-
-    // Use timeout for first cleaning, then set_interval for subsequent ones
-    // This prevents immediate execution when the switch is toggled
-    this->set_timeout(
-        "auto_clean_first", this->auto_cleaning_interval_ms_, [this]() {
-          ESP_LOGI(TAG, "Triggering First Scheduled Auto Fan Cleaning");
-          this->start_fan_cleaning_();
-
-          // Now set up recurring interval for subsequent cleanings
-          this->set_interval(
-              "auto_clean", this->auto_cleaning_interval_ms_, [this]() {
-                ESP_LOGI(TAG, "Triggering Scheduled Auto Fan Cleaning");
-                this->start_fan_cleaning_();
-              });
-        });
-  } else {
-    ESP_LOGI(TAG, "Disabling Auto Fan Cleaning");
-  }
+void Sen6xBusScheduler::release(uint8_t slot, uint32_t used_us) {
+  if (slot >= SEN6X_BUS_SCHEDULER_MAX_DEVICES)
+    return;
+  this->used_us_ += used_us;
 }
 
-// Reads 'len' bytes from the sensor after sending 'command'
-// 'buffer' must be of size 'len'
-bool Sen6xComponent::read_bytes_(uint16_t command, uint8_t *buffer,
-                                 uint8_t len) {
-  if (!this->write_command_(command))
-    return false;
-
-  delay(20); // 20ms wait for processing (standard for most SEN66 commands)
+// ========== ASYNCHRONOUS TRANSACTION ENGINE ==========
+// Sensirion commands are: write command (+ payload) -> wait execution time ->
+// read response words with CRC. Instead of delay() between write and read,
+// transactions are queued and advanced from loop() so the main loop never
+// stalls on the sensor.
+
+void Sen6xComponent::loop() {
+#ifdef USE_SEN6X_SENSOR_TASK
+  // Queued transactions wait while the sensor task owns the bus
+  bool task_owns_bus =
+      this->sensor_task_ != nullptr && this->service_sensor_task_();
+#else
+  bool task_owns_bus = false;
+#endif
 
-  // Calculate total bytes to read: len is data bytes.
-  // Wire format: For every 2 data bytes, 1 CRC byte.
-  // So if len=32 (Product Name), that's 16 words. 16 * 3 = 48 bytes on wire.
+  // Bus work is metered by the shared scheduler so many instances don't all
+  // block the same loop iteration
+  if (!task_owns_bus && this->transaction_bus_pending_() &&
+      global_sen6x_bus_scheduler.acquire(this->bus_slot_)) {
+    uint32_t start = micros();
+    this->process_transactions_();
+    global_sen6x_bus_scheduler.release(this->bus_slot_, micros() - start);
+  }
+
+  // Post-start configuration is done once its transactions have drained
+  if (this->boot_phase_ == Sen6xBootPhase::POST_START &&
+      this->transaction_count_ == 0 &&
+      this->transaction_state_ == TransactionState::IDLE) {
+    this->boot_phase_ = Sen6xBootPhase::READY;
+    ESP_LOGI(TAG, "SEN6x configured and measuring");
+    this->publish_breaker_state_();
+    this->begin_duty_cycle_();
+    this->ready_callback_.call();
+  }
+}
 
-  size_t wire_len = len + (len / 2); // 1 CRC per 2 bytes
-  uint8_t raw_buffer[wire_len];
+bool Sen6xComponent::queue_read_(uint16_t command, uint8_t words,
+                                 Sen6xTransactionCallback &&callback,
+                                 uint16_t execution_time_ms) {
+  Sen6xTransaction transaction{};
+  transaction.command = command;
+  transaction.response_words = words;
+  transaction.execution_time_ms = execution_time_ms;
+  transaction.callback = std::move(callback);
+  return this->queue_transaction_(std::move(transaction));
+}
 
-  if (this->read(raw_buffer, wire_len) != i2c::ERROR_OK) {
-    ESP_LOGW(TAG, "I2C read failed for command 0x%04X", command);
+bool Sen6xComponent::queue_write_(uint16_t command, const uint16_t *payload,
+                                  uint8_t payload_words,
+                                  Sen6xTransactionCallback &&callback,
+                                  uint16_t execution_time_ms) {
+  if (payload_words > SEN6X_MAX_REQUEST_WORDS) {
+    ESP_LOGE(TAG, "Payload too large for command 0x%04X", command);
     return false;
   }
+  Sen6xTransaction transaction{};
+  transaction.command = command;
+  for (uint8_t i = 0; i < payload_words; i++)
+    transaction.payload[i] = payload[i];
+  transaction.payload_words = payload_words;
+  transaction.execution_time_ms = execution_time_ms;
+  transaction.callback = std::move(callback);
+  return this->queue_transaction_(std::move(transaction));
+}
 
-  // Unpack and CRC check
-  int idx = 0;
-  for (int i = 0; i < len; i += 2) {
-    uint8_t b1 = raw_buffer[idx++];
-    uint8_t b2 = raw_buffer[idx++];
-    uint8_t crc = raw_buffer[idx++];
-
-    uint8_t data_to_check[2] = {b1, b2};
-    if (sen6x_crc(data_to_check, 2) != crc) {
-      ESP_LOGW(TAG, "CRC Error reading command 0x%04X, word %d", command,
-               i / 2);
-      return false;
-    }
-    buffer[i] = b1;
-    buffer[i + 1] = b2;
+bool Sen6xComponent::queue_transaction_(Sen6xTransaction &&transaction) {
+  if (transaction.response_words > SEN6X_MAX_RESPONSE_WORDS) {
+    ESP_LOGE(TAG, "Response too large for command 0x%04X",
+             transaction.command);
+    return false;
+  }
+  if (this->breaker_state_ == Sen6xBreakerState::OPEN) {
+    // Backing off after a bus fault: fail fast, no bus access, no log
+    if (transaction.callback)
+      transaction.callback(false, nullptr, 0);
+    return false;
   }
+  if (this->transaction_count_ >= SEN6X_TRANSACTION_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Transaction queue full, dropping command 0x%04X",
+             transaction.command);
+    if (transaction.callback)
+      transaction.callback(false, nullptr, 0);
+    return false;
+  }
+  uint8_t tail = (this->transaction_head_ + this->transaction_count_) %
+                 SEN6X_TRANSACTION_QUEUE_SIZE;
+  this->transaction_queue_[tail] = std::move(transaction);
+  this->transaction_count_++;
   return true;
 }
 
-// Reads 'words' 16-bit words from the sensor after sending 'command'
-// 'data' array must be of size 'words'
-bool Sen6xComponent::read_words_(uint16_t command, uint16_t *data,
-                                 uint8_t words) {
-  if (!this->write_command_(command))
-    return false;
-
-  delay(20); // 20ms wait for processing
-
-  // Each word is 2 bytes data + 1 byte CRC = 3 bytes on wire
-  size_t wire_len = words * 3;
-  uint8_t raw_buffer[wire_len];
-
-  if (this->read(raw_buffer, wire_len) != i2c::ERROR_OK) {
-    ESP_LOGW(TAG, "I2C read failed for command 0x%04X", command);
-    return false;
+// True when process_transactions_() would touch the bus in this loop
+bool Sen6xComponent::transaction_bus_pending_() const {
+  if (this->transaction_state_ == TransactionState::WAITING) {
+    const Sen6xTransaction &current =
+        this->transaction_queue_[this->transaction_head_];
+    return millis() - this->transaction_started_ms_ >=
+           current.execution_time_ms;
   }
+  return this->transaction_count_ > 0;
+}
 
-  // Unpack and CRC check
-  int idx = 0;
-  for (int i = 0; i < words; i++) {
-    uint8_t msb = raw_buffer[idx++];
-    uint8_t lsb = raw_buffer[idx++];
-    uint8_t crc = raw_buffer[idx++];
+void Sen6xComponent::process_transactions_() {
+  // Complete the in-flight transaction once its execution time has elapsed
+  if (this->transaction_state_ == TransactionState::WAITING) {
+    const Sen6xTransaction &current =
+        this->transaction_queue_[this->transaction_head_];
+    if (millis() - this->transaction_started_ms_ < current.execution_time_ms)
+      return;
+    this->complete_transaction_();
+  }
 
-    uint8_t data_to_check[2] = {msb, lsb};
-    if (sen6x_crc(data_to_check, 2) != crc) {
-      ESP_LOGW(TAG, "CRC Error reading command 0x%04X, word %d", command, i);
-      return false;
-    }
-    data[i] = (msb << 8) | lsb;
+  // Start the next queued transaction (write phase only, never blocks)
+  if (this->transaction_count_ == 0)
+    return;
+  Sen6xTransaction &next = this->transaction_queue_[this->transaction_head_];
+  bool written = next.payload_words > 0
+                     ? this->write_command_with_words_(
+                           next.command, next.payload, next.payload_words)
+                     : this->write_command_(next.command);
+  if (!written) {
+    ESP_LOGW(TAG, "I2C write failed for command 0x%04X", next.command);
+    this->error_code_ = COMMUNICATION_FAILED;
+    Sen6xTransactionCallback callback = std::move(next.callback);
+    this->transaction_head_ =
+        (this->transaction_head_ + 1) % SEN6X_TRANSACTION_QUEUE_SIZE;
+    this->transaction_count_--;
+    this->record_bus_result_(false);
+    if (callback)
+      callback(false, nullptr, 0);
+    return;
   }
-  return true;
+  this->transaction_started_ms_ = millis();
+  this->transaction_state_ = TransactionState::WAITING;
 }
 
-// This method reads measurement values using the model-specific command
-// Each SEN6x model has its own I2C command (Datasheet v0.92 Table 26)
-bool Sen6xComponent::read_measurement_data_(uint16_t *data, uint8_t len) {
-  uint16_t cmd;
-  switch (this->model_) {
-  case Sen6xModel::SEN62:
-    cmd = SEN6X_CMD_READ_SEN62;
-    break;
-  case Sen6xModel::SEN63C:
-    cmd = SEN6X_CMD_READ_SEN63C;
-    break;
-  case Sen6xModel::SEN65:
-    cmd = SEN6X_CMD_READ_SEN65;
-    break;
-  case Sen6xModel::SEN66:
-    cmd = SEN6X_CMD_READ_SEN66;
-    break;
-  case Sen6xModel::SEN68:
-    cmd = SEN6X_CMD_READ_SEN68;
-    break;
-  case Sen6xModel::SEN69C:
-    cmd = SEN6X_CMD_READ_SEN69C;
-    break;
-  default:
-    cmd = SEN6X_CMD_READ_SEN66; // Fallback to SEN66
-    break;
+void Sen6xComponent::complete_transaction_() {
+  Sen6xTransaction &current = this->transaction_queue_[this->transaction_head_];
+  uint16_t command = current.command;
+  uint8_t words = current.response_words;
+  Sen6xTransactionCallback callback = std::move(current.callback);
+
+  // Pop before invoking the callback so it can queue follow-up transactions
+  this->transaction_head_ =
+      (this->transaction_head_ + 1) % SEN6X_TRANSACTION_QUEUE_SIZE;
+  this->transaction_count_--;
+  this->transaction_state_ = TransactionState::IDLE;
+
+  if (words == 0) {
+    this->record_bus_result_(true);
+    if (callback)
+      callback(true, nullptr, 0);
+    return;
   }
-  return this->read_words_(cmd, data, len);
-}
 
-// Returns the number of data words based on sensor model (Datasheet v0.92)
-uint8_t Sen6xComponent::get_measurement_word_count_() {
-  switch (this->model_) {
-  case Sen6xModel::SEN62:
-    return 6; // PM1,PM2.5,PM4,PM10,RH,T
-  case Sen6xModel::SEN63C:
-    return 7; // PM1,PM2.5,PM4,PM10,RH,T,CO2
-  case Sen6xModel::SEN65:
-    return 8; // PM1,PM2.5,PM4,PM10,RH,T,VOC,NOx
-  case Sen6xModel::SEN66:
-    return 9; // PM1,PM2.5,PM4,PM10,RH,T,VOC,NOx,CO2
-  case Sen6xModel::SEN68:
-    return 9; // PM1,PM2.5,PM4,PM10,RH,T,VOC,NOx,HCHO (no CO2)
-  case Sen6xModel::SEN69C:
-    return 10; // PM1,PM2.5,PM4,PM10,RH,T,VOC,NOx,HCHO,CO2
-  default:
-    return 9;
+  // Each word is 2 bytes data + 1 byte CRC = 3 bytes on wire
+  uint8_t raw_buffer[SEN6X_MAX_RESPONSE_WORDS * 3];
+  if (this->bus_read_(command, raw_buffer, words * 3) != i2c::ERROR_OK) {
+    ESP_LOGW(TAG, "I2C read failed for command 0x%04X", command);
+    this->error_code_ = COMMUNICATION_FAILED;
+    this->record_bus_result_(false);
+    if (callback)
+      callback(false, nullptr, 0);
+    return;
+  }
+
+  int bad_word = sen6x_unpack_frame(raw_buffer, words, this->response_words_);
+  if (bad_word >= 0) {
+    ESP_LOGW(TAG, "CRC Error reading command 0x%04X, word %d", command,
+             bad_word);
+    this->diagnostics_.record_crc_error(command);
+    this->error_code_ = CRC_CHECK_FAILED;
+    this->record_bus_result_(false);
+    if (callback)
+      callback(false, nullptr, 0);
+    return;
   }
+  this->error_code_ = NONE;
+  this->record_bus_result_(true);
+  if (callback)
+    callback(true, this->response_words_, words);
 }
 
 void Sen6xComponent::dump_config() {
@@ -1552,9 +3832,11 @@ void Sen6xComponent::dump_config() {
   LOG_SENSOR("  ", "NOx Index", this->nox_sensor_);
   LOG_SENSOR("  ", "CO2", this->co2_sensor_);
   LOG_SENSOR("  ", "Formaldehyde", this->formaldehyde_sensor_);
+#ifdef USE_SEN6X_TVOC
   LOG_SENSOR("  ", "TVOC WELL", this->well_tvoc_sensor_);
   LOG_SENSOR("  ", "TVOC RESET", this->reset_tvoc_sensor_);
   LOG_SENSOR("  ", "TVOC Ethanol", this->tvoc_ethanol_sensor_);
+#endif
 
   if (this->voc_algorithm_tuning_720h_) {
     ESP_LOGCONFIG(TAG, "  VOC Algorithm Tuning: 720h (Building Standards)");
@@ -1562,15 +3844,134 @@ void Sen6xComponent::dump_config() {
     ESP_LOGCONFIG(TAG, "  VOC Algorithm Tuning: 12h (Default)");
   }
 
-  // Altitude persistence diagnostic (shows boot-loaded value)
-  ESP_LOGCONFIG(TAG, "  Altitude (loaded from NVS): %.1f m%s",
-                this->pending_altitude_,
-                std::isnan(this->pending_altitude_) ? " [NOT FOUND]" : "");
+  // VOC baseline store policy (upper bound on baseline flash writes)
+  if (this->store_baseline_) {
+    uint32_t interval_min = this->baseline_store_interval_ms_ / 60000;
+    ESP_LOGCONFIG(TAG,
+                  "  VOC Baseline Store: every >= %u min, diff > %u (max %u "
+                  "writes/day)",
+                  (unsigned int)interval_min,
+                  (unsigned int)this->baseline_store_diff_,
+                  (unsigned int)(1440 / (interval_min > 0 ? interval_min : 1)));
+  } else {
+    ESP_LOGCONFIG(TAG, "  VOC Baseline Store: disabled");
+  }
+#ifdef USE_SEN6X_FLASH_WRITES
+  LOG_SENSOR("  ", "Flash Writes", this->flash_writes_sensor_);
+#endif
+  ESP_LOGCONFIG(TAG,
+                "  Auto Fan Cleaning: %s, every %u h of fan runtime (%u h "
+                "since the last, %u cleanings)",
+                this->config_.auto_cleaning ? "ON" : "OFF",
+                (unsigned int)(this->auto_cleaning_interval_ms_ / 3600000),
+                (unsigned int)(this->cleaning_record_.runtime_s / 3600),
+                (unsigned int)this->cleaning_record_.cleanings);
+  if (!std::isnan(this->quiet_max_pm_stddev_))
+    ESP_LOGCONFIG(TAG,
+                  "    Quiet: PM2.5 stddev <= %.1f ug/m3, max delay %u h",
+                  this->quiet_max_pm_stddev_,
+                  (unsigned int)(this->quiet_max_delay_ms_ / 3600000));
+#ifdef USE_SEN6X_CLEANING_CLOCK
+  if (this->quiet_clock_ != nullptr)
+    ESP_LOGCONFIG(TAG, "    Quiet: %02u:%02u - %02u:%02u",
+                  (unsigned int)(this->quiet_window_start_ / 60),
+                  (unsigned int)(this->quiet_window_start_ % 60),
+                  (unsigned int)(this->quiet_window_end_ / 60),
+                  (unsigned int)(this->quiet_window_end_ % 60));
+#endif
+  if (this->sht_heater_interval_ms_ > 0)
+    ESP_LOGCONFIG(TAG, "  SHT Heater: every %u min (RH >= %.0f%%)",
+                  (unsigned int)(this->sht_heater_interval_ms_ / 60000),
+                  std::isnan(this->sht_heater_min_humidity_)
+                      ? 0.0f
+                      : this->sht_heater_min_humidity_);
+  if (this->co2_stability_.enabled())
+    ESP_LOGCONFIG(TAG, "  FRC Gate: %u samples within %u ppm",
+                  (unsigned int)this->co2_stability_.size(),
+                  (unsigned int)this->co2_max_spread_);
+#ifdef USE_SEN6X_CO2_CORRECTION
+  LOG_SENSOR("  ", "CO2 Correction", this->co2_correction_sensor_);
+#endif
+#ifdef USE_SEN6X_HEATER_SENSORS
+  LOG_SENSOR("  ", "Heater Humidity", this->heater_humidity_sensor_);
+  LOG_SENSOR("  ", "Heater Temperature", this->heater_temperature_sensor_);
+#endif
+  ESP_LOGCONFIG(TAG,
+                "  Bus Fault Breaker: %u failures, backoff %u s (max %u s), "
+                "%u faults",
+                (unsigned int)this->breaker_threshold_,
+                (unsigned int)(this->breaker_initial_backoff_ms_ / 1000),
+                (unsigned int)(this->breaker_max_backoff_ms_ / 1000),
+                (unsigned int)this->breaker_trips_);
+#ifdef USE_SEN6X_DIAGNOSTICS
+  ESP_LOGCONFIG(TAG, "  Diagnostics Interval: %u ms",
+                (unsigned int)this->diagnostics_interval_ms_);
+#endif
+#ifdef USE_SEN6X_BURST
+  ESP_LOGCONFIG(TAG, "  Burst: every %u ms for %u s",
+                (unsigned int)this->burst_interval_ms_,
+                (unsigned int)(this->burst_duration_ms_ / 1000));
+  for (const Sen6xBurstTrigger &trigger : this->burst_triggers_) {
+    if (trigger.channel != Sen6xChannel::COUNT)
+      ESP_LOGCONFIG(TAG, "    Trigger: channel %u step >= %.1f",
+                    (unsigned int)trigger.channel, trigger.step);
+  }
+#endif
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  for (const Sen6xRollingAverage &average : this->rolling_averages_) {
+    if (average.channel != Sen6xChannel::COUNT)
+      ESP_LOGCONFIG(TAG, "  Rolling Average: channel %u over %u min, "
+                         "%u buckets",
+                    (unsigned int)average.channel,
+                    (unsigned int)(average.mean.window_ms() / 60000),
+                    average.mean.bucket_count());
+  }
+#endif
+#ifdef USE_SEN6X_DUTY_CYCLE
+  if (this->duty_period_ms_ > 0) {
+    ESP_LOGCONFIG(TAG,
+                  "  Duty Cycle: every %u s, warm-up PM %u s, RH/T %u s, "
+                  "VOC/NOx %u s, CO2 %u s, HCHO %u s",
+                  (unsigned int)(this->duty_period_ms_ / 1000),
+                  (unsigned int)(this->warm_up_ms_[0] / 1000),
+                  (unsigned int)(this->warm_up_ms_[1] / 1000),
+                  (unsigned int)(this->warm_up_ms_[2] / 1000),
+                  (unsigned int)(this->warm_up_ms_[3] / 1000),
+                  (unsigned int)(this->warm_up_ms_[4] / 1000));
+#ifdef USE_SEN6X_DUTY_RATIO
+    LOG_SENSOR("    ", "Duty Ratio", this->duty_ratio_sensor_);
+#endif
+  }
+#endif
+#ifdef USE_SEN6X_SENSOR_TASK
+  if (this->sensor_task_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Sensor Task: core %u, priority %u, stack %u bytes",
+                  (unsigned int)this->sensor_task_core_,
+                  (unsigned int)this->sensor_task_priority_,
+                  (unsigned int)this->sensor_task_stack_size_);
+    if (this->polling_mode_ == Sen6xPollingMode::PHASE_LOCKED)
+      ESP_LOGCONFIG(TAG, "    Phase lock unused (task waits for data ready)");
+  } else {
+    ESP_LOGCONFIG(TAG, "  Sensor Task: not running");
+  }
+#endif
+#ifdef USE_SEN6X_CAPTURE
+  ESP_LOGCONFIG(TAG, "  Capture Buffer: %u bytes",
+                (unsigned int)this->capture_ring_.get_size());
+#endif
+
+  // Altitude persistence diagnostic (only when restored at boot)
+  if (!std::isnan(this->pending_altitude_))
+    ESP_LOGCONFIG(TAG, "  Altitude (loaded from NVS): %.1f m",
+                  this->pending_altitude_);
 
+#ifdef USE_SEN6X_TEXT_SENSOR
   LOG_TEXT_SENSOR("  ", "Product Name", this->product_name_text_sensor_);
   LOG_TEXT_SENSOR("  ", "Serial Number", this->serial_number_text_sensor_);
   LOG_TEXT_SENSOR("  ", "Status Hex", this->status_text_sensor_);
+#endif
 
+#ifdef USE_SEN6X_BINARY_SENSOR
   LOG_BINARY_SENSOR("  ", "Fan Error", this->fan_error_binary_sensor_);
   LOG_BINARY_SENSOR("  ", "Fan Warning", this->fan_warning_binary_sensor_);
   LOG_BINARY_SENSOR("  ", "Gas Error", this->gas_error_binary_sensor_);
@@ -1579,6 +3980,7 @@ void Sen6xComponent::dump_config() {
   LOG_BINARY_SENSOR("  ", "Laser Error", this->laser_error_binary_sensor_);
   LOG_BINARY_SENSOR("  ", "Cleaning Active",
                     this->fan_cleaning_active_binary_sensor_);
+#endif
 
   // Model validation warnings
   const char *model_name;
@@ -1606,51 +4008,28 @@ void Sen6xComponent::dump_config() {
     break;
   }
   ESP_LOGCONFIG(TAG, "  Model: %s", model_name);
-
-  // VOC/NOx validation (only SEN65, SEN66, SEN68, SEN69C have VOC/NOx)
-  bool has_voc =
-      (this->model_ == Sen6xModel::SEN65 || this->model_ == Sen6xModel::SEN66 ||
-       this->model_ == Sen6xModel::SEN68 || this->model_ == Sen6xModel::SEN69C);
-  if (!has_voc) {
-    if (this->voc_index_sensor_ != nullptr) {
-      ESP_LOGW(TAG,
-               "  WARNING: VOC sensor configured but %s does not have VOC!",
-               model_name);
-    }
-    if (this->nox_sensor_ != nullptr) {
-      ESP_LOGW(TAG,
-               "  WARNING: NOx sensor configured but %s does not have NOx!",
-               model_name);
-    }
-  }
-
-  // CO2 validation (only SEN63C, SEN66, SEN69C have CO2)
-  bool has_co2 =
-      (this->model_ == Sen6xModel::SEN63C ||
-       this->model_ == Sen6xModel::SEN66 || this->model_ == Sen6xModel::SEN69C);
-  if (!has_co2 && this->co2_sensor_ != nullptr) {
-    ESP_LOGW(TAG, "  WARNING: CO2 sensor configured but %s does not have CO2!",
-             model_name);
-  }
-
-  // HCHO validation (only SEN68, SEN69C have HCHO)
-  bool has_hcho =
-      (this->model_ == Sen6xModel::SEN68 || this->model_ == Sen6xModel::SEN69C);
-  if (!has_hcho && this->formaldehyde_sensor_ != nullptr) {
-    ESP_LOGW(TAG,
-             "  WARNING: Formaldehyde sensor configured but %s does not have "
-             "HCHO!",
-             model_name);
-  }
-
-  // PM4.0 validation (SEN63C, SEN65, SEN68 don't have PM4.0)
-  bool has_pm4 =
-      (this->model_ == Sen6xModel::SEN62 || this->model_ == Sen6xModel::SEN66 ||
-       this->model_ == Sen6xModel::SEN69C);
-  if (!has_pm4 && this->pm_4_0_sensor_ != nullptr) {
-    ESP_LOGW(TAG,
-             "  WARNING: PM4.0 sensor configured but %s does not have PM4.0!",
-             model_name);
+  ESP_LOGCONFIG(TAG, "  Bus scheduler slot: %u of %u (budget %u us/loop)",
+                this->bus_slot_ + 1,
+                global_sen6x_bus_scheduler.get_device_count(),
+                (unsigned int)global_sen6x_bus_scheduler.get_budget_us());
+
+  // Configured sensors the model's frame does not carry
+  struct {
+    Sen6xChannel channel;
+    const sensor::Sensor *sensor;
+    const char *name;
+  } const checks[] = {
+      {Sen6xChannel::PM_4_0, this->pm_4_0_sensor_, "PM4.0"},
+      {Sen6xChannel::VOC_INDEX, this->voc_index_sensor_, "VOC"},
+      {Sen6xChannel::NOX_INDEX, this->nox_sensor_, "NOx"},
+      {Sen6xChannel::CO2, this->co2_sensor_, "CO2"},
+      {Sen6xChannel::FORMALDEHYDE, this->formaldehyde_sensor_, "HCHO"},
+  };
+  for (const auto &check : checks) {
+    if (check.sensor != nullptr &&
+        !sen6x_model_has_channel(this->model_, check.channel))
+      ESP_LOGW(TAG, "  WARNING: %s sensor configured but %s does not have %s!",
+               check.name, model_name, check.name);
   }
 }
 
@@ -2,18 +2,51 @@
 
 #pragma once
 
-#include "esphome/components/binary_sensor/binary_sensor.h"
-#include "esphome/components/button/button.h"
 #include "esphome/components/i2c/i2c.h"
-#include "esphome/components/number/number.h"
 #include "esphome/components/sensor/sensor.h"
-#include "esphome/components/switch/switch.h"
-#include "esphome/components/text_sensor/text_sensor.h"
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
+#include "environmental_physics.h"
+#include "sen6x_aggregation.h"
+#include "sen6x_calibration.h"
+#include "sen6x_capture.h"
+#include "sen6x_cleaning.h"
+#include "sen6x_diagnostics.h"
+#include "sen6x_pressure.h"
+#include "sen6x_rolling.h"
+#include "sen6x_telemetry.h"
+#include <cstring>
 #include <functional>
 
+// Optional subsystems are compiled in only when codegen emits their
+// USE_SEN6X_* define (platform or channels present in YAML)
+#ifdef USE_SEN6X_BINARY_SENSOR
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#endif
+#ifdef USE_SEN6X_BUTTON
+#include "esphome/components/button/button.h"
+#endif
+#ifdef USE_SEN6X_NUMBER
+#include "esphome/components/number/number.h"
+#endif
+#ifdef USE_SEN6X_SWITCH
+#include "esphome/components/switch/switch.h"
+#endif
+#ifdef USE_SEN6X_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+#ifdef USE_SEN6X_CLEANING_CLOCK
+#include "esphome/components/time/real_time_clock.h"
+#endif
+#ifdef USE_SEN6X_SENSOR_TASK
+#include "sen6x_task.h"
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace sen6x {
 
@@ -42,6 +75,8 @@ static const uint16_t SEN6X_CMD_GET_SENSOR_ALTITUDE = 0x6736;
 static const uint16_t SEN6X_CMD_START_FAN_CLEANING = 0x5607;
 static const uint16_t SEN6X_CMD_DEVICE_RESET = 0xD304;
 static const uint16_t SEN6X_CMD_SET_TEMP_OFFSET = 0x60B2;
+static const uint16_t SEN6X_CMD_SET_VOC_TUNING = 0x60D0;
+static const uint16_t SEN6X_CMD_SET_NOX_TUNING = 0x60E1;
 // CO2 Calibration Commands (SEN63C, SEN66, SEN69C only)
 static const uint16_t SEN6X_CMD_FORCED_CO2_RECAL = 0x6707;
 static const uint16_t SEN6X_CMD_CO2_FACTORY_RESET = 0x6754;
@@ -57,9 +92,19 @@ static const uint16_t SEN6X_CMD_NUMBER_CONCENTRATION = 0x0316;
 static const uint16_t SEN6X_CMD_ACTIVATE_SHT_HEATER = 0x6765;
 static const uint16_t SEN6X_CMD_GET_SHT_HEATER_MEASUREMENTS = 0x6790;
 
-// Store baseline interval and threshold (same as SEN5x official)
+// Device Status register flags (Sensirion SEN6x datasheet/driver)
+static const uint32_t SEN6X_STATUS_FAN_SPEED_WARNING = 1UL << 21;
+static const uint32_t SEN6X_STATUS_RHT_ERROR = 1UL << 20;
+static const uint32_t SEN6X_STATUS_GAS_ERROR = 1UL << 19;
+static const uint32_t SEN6X_STATUS_PM_ERROR = 1UL << 18;
+static const uint32_t SEN6X_STATUS_LASER_ERROR = 1UL << 17;
+
+// Store baseline interval and threshold (same as SEN5x official), defaults
+// for voc_baseline: min_interval / max_diff
 static const uint32_t SHORTEST_BASELINE_STORE_INTERVAL = 10800; // 3 hours
 static const uint32_t MAXIMUM_STORAGE_DIFF = 50;
+static const uint32_t SEN6X_BASELINE_CHECK_INTERVAL_MS =
+    600000; // Re-check an unchanged state every 10 min once the interval ran
 
 // Structure for storing VOC baseline state
 struct Sen6xBaselines {
@@ -67,6 +112,54 @@ struct Sen6xBaselines {
   int32_t state1;
 } __attribute__((packed));
 
+// Persisted configuration: one packed record per sensor (keyed by serial)
+// instead of one preference object per setting. Bump the version when the
+// layout changes; a record with another version is ignored.
+static const uint8_t SEN6X_CONFIG_VERSION = 1;
+static const uint32_t SEN6X_CONFIG_COMMIT_DELAY_MS =
+    5000; // Coalesces bursts of changes into one flash write
+
+// Fields are ordered so the record has no padding
+struct Sen6xConfigRecord {
+  uint8_t version;
+  bool co2_asc;
+  bool auto_cleaning;
+  uint8_t reserved;
+  float altitude;           // [m], NAN = not set (read from device)
+  float ambient_pressure;   // [hPa], NAN = not set
+  float temperature_offset; // [°C], NAN = not set
+  float outdoor_co2_ppm;    // NAN = not set (YAML default)
+  Sen6xBaselines voc_baselines;
+};
+static_assert(sizeof(Sen6xConfigRecord) == 28,
+              "Sen6xConfigRecord layout changed, bump SEN6X_CONFIG_VERSION");
+
+// Written over a migrated per-setting preference (hash + 2..8). ESPHome has
+// no erase; a slot holding another length never loads as the old type.
+struct Sen6xLegacyTombstone {
+  uint32_t marker[3];
+};
+
+// Cached device identity (preference_hash_ + offset, keyed by serial).
+// Product name, model and firmware version do not change for a serial, so
+// a warm boot reads only the serial (needed for the hash anyway) and skips
+// the product name and firmware reads. Strings are NUL padded.
+static const uint8_t SEN6X_IDENTITY_VERSION = 1;
+static const uint32_t SEN6X_IDENTITY_PREFERENCE_OFFSET = 9;
+static const uint8_t SEN6X_IDENTITY_STRING_LEN = 32; // 16 words on the wire
+
+struct Sen6xIdentityRecord {
+  uint8_t version;
+  uint8_t model; // Sen6xModel detected from the product name
+  uint8_t firmware_major;
+  uint8_t firmware_minor;
+  char serial_number[SEN6X_IDENTITY_STRING_LEN + 1];
+  char product_name[SEN6X_IDENTITY_STRING_LEN + 1];
+  uint8_t reserved[2];
+};
+static_assert(sizeof(Sen6xIdentityRecord) == 72,
+              "Sen6xIdentityRecord changed, bump SEN6X_IDENTITY_VERSION");
+
 // Structure for temperature compensation parameters (same as SEN5x official)
 struct TemperatureCompensation {
   int16_t offset;                  // Scaled x200 (°C)
@@ -98,6 +191,265 @@ struct RhtAcceleration {
   uint16_t t2; // Time constant T2 (scaled x10, T2[s] = t2/10)
 };
 
+// Asynchronous I2C transaction engine limits
+// Largest response is Product Name / Serial Number (32 bytes = 16 words)
+// Largest request payload is VOC algorithm tuning (6 words)
+static const uint8_t SEN6X_MAX_RESPONSE_WORDS = 16;
+static const uint8_t SEN6X_MAX_REQUEST_WORDS = 6;
+static const uint8_t SEN6X_TRANSACTION_QUEUE_SIZE = 16;
+static const uint16_t SEN6X_DEFAULT_EXECUTION_TIME_MS =
+    20; // Standard execution time for most SEN6x commands
+static const uint16_t SEN6X_START_MEASUREMENT_TIME_MS = 50; // Datasheet: 50ms
+static const uint16_t SEN6X_STOP_MEASUREMENT_TIME_MS =
+    1500; // Datasheet requires > 1400ms after stop command
+static const uint16_t SEN6X_FRC_EXECUTION_TIME_MS = 550; // Datasheet: 500ms
+static const uint16_t SEN6X_DEVICE_RESET_TIME_MS = 1200; // Datasheet: 1200ms
+// Datasheet 4.8.31: >= 3 min in measurement mode before FRC
+static const uint32_t SEN6X_FRC_MIN_MEASUREMENT_MS = 180000;
+static const uint16_t SEN6X_CO2_FACTORY_RESET_TIME_MS =
+    1500; // Datasheet: 1400ms
+static const uint16_t SEN6X_SHT_HEATER_TIME_MS = 1300; // Datasheet: 1300ms
+static const uint32_t SEN6X_SHT_HEATER_COOLDOWN_MS =
+    20000; // Datasheet: wait >= 20s after activation before starting
+// Heater readback (0x6790) reads 0x7FFF until the heater cycle has ended
+static const uint16_t SEN6X_SHT_HEATER_POLL_MS = 50; // Datasheet: 50ms
+static const uint8_t SEN6X_SHT_HEATER_POLL_LIMIT = 100; // 5s, then give up
+
+// Completion callback: ok = write (+ read and CRC, if any) succeeded
+// data points to 'words' decoded words (nullptr for write-only transactions)
+using Sen6xTransactionCallback =
+    std::function<void(bool ok, const uint16_t *data, uint8_t words)>;
+
+// Queued I2C transaction: write command (+ payload) -> wait -> read + CRC
+struct Sen6xTransaction {
+  uint16_t command;
+  uint16_t payload[SEN6X_MAX_REQUEST_WORDS];
+  uint8_t payload_words;
+  uint8_t response_words; // 0 = write-only (still waits execution time)
+  uint16_t execution_time_ms;
+  Sen6xTransactionCallback callback;
+};
+
+// Optional sensor task (ESP32, USE_SEN6X_SENSOR_TASK): update() hands the
+// cycle's reads to a pinned FreeRTOS task as a request mask, the task
+// returns raw words and decoding/publishing stays on the main loop
+static const uint32_t SEN6X_TASK_READ_STATUS = 1UL << 0;
+static const uint32_t SEN6X_TASK_READ_FRAME = 1UL << 1;
+static const uint32_t SEN6X_TASK_READ_NC = 1UL << 2;
+static const uint8_t SEN6X_TASK_RING_SIZE = 8; // Holds a bit over two cycles
+static const uint8_t SEN6X_DEFAULT_TASK_CORE = 0; // Loop task runs on core 1
+static const uint8_t SEN6X_DEFAULT_TASK_PRIORITY = 5;
+static const uint32_t SEN6X_DEFAULT_TASK_STACK_SIZE = 4096; // [bytes]
+
+enum class Sen6xTaskResult : uint8_t {
+  OK,
+  BUS_ERROR, // Write or read not acknowledged
+  CRC_ERROR,
+};
+
+// One response read by the sensor task. A GET_DATA_READY sample with result
+// OK means no new data arrived within the task's wait budget.
+struct Sen6xTaskSample {
+  uint32_t timestamp_ms;
+  uint16_t command;
+  Sen6xTaskResult result;
+  uint8_t words;
+  uint16_t data[SEN6X_MAX_RESPONSE_WORDS];
+  Sen6xBusStats bus;   // Transfers of 'command'
+  Sen6xBusStats probe; // Data-ready probes before a frame
+};
+
+// Boot sequence phases (setup() runs asynchronously on the transaction queue)
+enum class Sen6xBootPhase : uint8_t {
+  STOPPING,    // Stop Measurement sent, waiting for Idle Mode
+  CONFIGURING, // Idle-mode configuration (serial, tuning, baseline, altitude)
+  STARTING,    // Start Measurement queued
+  POST_START,  // Measurement-mode configuration (identity, pressure, offset)
+  READY,       // Configured and measuring
+  FAILED,
+};
+
+// Measurement scheduling: probe data-ready on every update (INTERVAL) or
+// track the sensor's 1 s cadence and read just after new data is ready
+enum class Sen6xPollingMode : uint8_t {
+  INTERVAL = 0,
+  PHASE_LOCKED,
+};
+
+static const uint16_t SEN6X_MEASUREMENT_PERIOD_MS =
+    1000; // Sensor updates its measurement every 1s
+static const uint16_t SEN6X_PHASE_MARGIN_MS =
+    30; // Read this long after the predicted data-ready edge
+static const uint16_t SEN6X_PHASE_PROBE_INTERVAL_MS =
+    50; // Data-ready probe spacing while (re)acquiring the phase
+static const uint8_t SEN6X_PHASE_MAX_PROBES =
+    30; // Give up acquisition after ~1.5 periods without an edge
+static const uint8_t SEN6X_PHASE_RELOCK_CYCLES =
+    30; // Re-measure the phase (and clock drift) every N locked reads
+
+// Read groups with their own decimation of the update interval
+enum class Sen6xPollGroup : uint8_t {
+  FRAME = 0,            // Measured values frame (and data-ready probe)
+  NUMBER_CONCENTRATION, // 0x0316
+  STATUS,               // Device Status (adaptive, see status_poll_due_())
+  READBACK,             // Ambient pressure / altitude readback
+  COUNT,
+};
+
+// Published measurement channels (index into per-channel state tables)
+enum class Sen6xChannel : uint8_t {
+  PM_1_0 = 0,
+  PM_2_5,
+  PM_4_0,
+  PM_10_0,
+  HUMIDITY,
+  TEMPERATURE,
+  VOC_INDEX,
+  NOX_INDEX,
+  CO2,
+  FORMALDEHYDE,
+  TVOC_WELL,
+  TVOC_RESET,
+  TVOC_ETHANOL,
+  NC_0_5,
+  NC_1_0,
+  NC_2_5,
+  NC_4_0,
+  NC_10_0,
+  COUNT,
+};
+
+// Raw word scaling per channel (value = raw / divisor). Derived channels
+// (TVOC estimates) have no raw word and use divisor 0.
+struct Sen6xChannelScale {
+  float divisor;
+  bool is_signed;    // int16 on the wire (0x7FFF invalid) vs uint16 (0xFFFF)
+  bool zero_invalid; // 0 also means "no value yet" (CO2/HCHO warm-up)
+};
+
+static const Sen6xChannelScale
+    SEN6X_CHANNEL_SCALES[static_cast<uint8_t>(Sen6xChannel::COUNT)] = {
+        {10.0f, false, false},  // PM_1_0 [µg/m³]
+        {10.0f, false, false},  // PM_2_5
+        {10.0f, false, false},  // PM_4_0
+        {10.0f, false, false},  // PM_10_0
+        {100.0f, true, false},  // HUMIDITY [%RH]
+        {200.0f, true, false},  // TEMPERATURE [°C]
+        {10.0f, true, false},   // VOC_INDEX
+        {10.0f, true, false},   // NOX_INDEX
+        {1.0f, false, true},    // CO2 [ppm]
+        {10.0f, false, true},   // FORMALDEHYDE [ppb]
+        {0.0f, false, false},   // TVOC_WELL (derived)
+        {0.0f, false, false},   // TVOC_RESET (derived)
+        {0.0f, false, false},   // TVOC_ETHANOL (derived)
+        {10.0f, false, false},  // NC_0_5 [#/cm³]
+        {10.0f, false, false},  // NC_1_0
+        {10.0f, false, false},  // NC_2_5
+        {10.0f, false, false},  // NC_4_0
+        {10.0f, false, false},  // NC_10_0
+};
+
+// Sensirion "not available" encodings: 0xFFFF (uint16), 0x7FFF (int16)
+inline bool sen6x_word_valid(Sen6xChannel channel, uint16_t raw) {
+  const Sen6xChannelScale &scale =
+      SEN6X_CHANNEL_SCALES[static_cast<uint8_t>(channel)];
+  if (raw == (scale.is_signed ? 0x7FFF : 0xFFFF))
+    return false;
+  return raw != 0 || !scale.zero_invalid;
+}
+
+// Burst sampling: a step of at least 'step' (engineering units) between two
+// consecutive samples of 'channel' starts or extends a burst
+struct Sen6xBurstTrigger {
+  Sen6xChannel channel{Sen6xChannel::COUNT}; // COUNT = unused slot
+  float step{NAN};
+  float last_value{NAN};
+};
+static const uint8_t SEN6X_MAX_BURST_TRIGGERS = 3; // PM2.5, CO2, VOC Index
+static const uint32_t SEN6X_DEFAULT_BURST_INTERVAL_MS = 1000;
+static const uint32_t SEN6X_DEFAULT_BURST_DURATION_MS = 300000;
+
+// Bus-fault circuit breaker: after 'threshold' consecutive failed
+// transactions the breaker opens, queued work is failed and nothing touches
+// the bus until a Device Status probe succeeds. Probes back off
+// exponentially; a successful one re-initializes measurement.
+enum class Sen6xBreakerState : uint8_t {
+  CLOSED = 0, // Normal operation
+  OPEN,       // Backing off, transactions rejected
+  HALF_OPEN,  // Probe in flight
+};
+static const uint8_t SEN6X_DEFAULT_BREAKER_THRESHOLD = 5;
+static const uint32_t SEN6X_DEFAULT_BREAKER_BACKOFF_MS = 5000;
+static const uint32_t SEN6X_DEFAULT_BREAKER_MAX_BACKOFF_MS = 300000;
+
+// Rolling window average of one channel (USE_SEN6X_ROLLING_AVERAGE), fed
+// with every decoded sample before aggregation and the publish filter and
+// published whenever a bucket closes
+struct Sen6xRollingAverage {
+  Sen6xChannel channel{Sen6xChannel::COUNT}; // COUNT = unused slot
+  sensor::Sensor *sensor{nullptr};
+  Sen6xRollingMean mean;
+  ESPPreferenceObject preference;
+};
+// PM2.5, PM10, CO2, HCHO, TVOC (WELL/RESET)
+static const uint8_t SEN6X_MAX_ROLLING_AVERAGES = 6;
+// Checkpoint preferences live at preference_hash_ + offset + channel
+static const uint32_t SEN6X_ROLLING_PREFERENCE_OFFSET = 16;
+
+// Duty-cycled measurement (USE_SEN6X_DUTY_CYCLE): measurement is stopped
+// between samples. After each start a channel is only published once its
+// warm-up group's allowance has passed (and the sensor reports it valid).
+enum class Sen6xWarmUpGroup : uint8_t {
+  PM = 0, // PM and Number Concentration (fan spin-up)
+  RHT,    // Humidity and Temperature
+  GAS,    // VOC and NOx Index
+  CO2,
+  FORMALDEHYDE,
+  COUNT,
+};
+
+enum class Sen6xDutyState : uint8_t {
+  CONTINUOUS = 0, // Duty cycling off (or not started yet)
+  AWAKE,          // Measuring, waiting for a stabilized frame
+  SLEEPING,       // Measurement stopped until the next period
+};
+
+static const uint32_t
+    SEN6X_DEFAULT_WARM_UP_MS[static_cast<uint8_t>(Sen6xWarmUpGroup::COUNT)] = {
+        30000, // PM
+        10000, // RHT
+        60000, // GAS
+        30000, // CO2
+        60000, // FORMALDEHYDE
+};
+static const uint32_t SEN6X_DUTY_STABLE_TIMEOUT_MS =
+    60000; // Go back to sleep this long past the longest warm-up regardless
+static const uint32_t SEN6X_DUTY_RETRY_MS =
+    1000; // Wake-up retry while cleaning or an idle window is in progress
+
+// Change-only publishing state per channel (filtered before publish_state)
+struct Sen6xPublishFilter {
+  float deadband{NAN};      // Min change to publish (NAN = not configured)
+  uint32_t heartbeat_ms{0}; // Republish unchanged value after this (0 = off)
+  float last_value{NAN};
+  uint32_t last_publish_ms{0};
+};
+
+// Idle-only configuration writes, coalesced into one Stop/Start window
+enum class Sen6xIdleAction : uint8_t {
+  ALTITUDE = 0,
+  CO2_ASC,
+  FORCED_CO2_RECAL,
+  CO2_FACTORY_RESET,
+  SHT_HEATER,
+  COUNT,
+};
+
+struct Sen6xIdleRequest {
+  bool pending;
+  float value; // Altitude [m], ASC (0/1), FRC reference [ppm]
+};
+
 // SEN6x Model Enum (per Sensirion Datasheet v0.91+)
 enum class Sen6xModel : uint8_t {
   SEN62 = 0,  // PM + RH/T
@@ -108,6 +460,107 @@ enum class Sen6xModel : uint8_t {
   SEN69C = 5, // PM + RH/T + VOC + NOx + CO2 + HCHO
 };
 
+// SEN63C/SEN69C: >= 24s between two measurement starts (datasheet)
+static const uint32_t SEN6X_CO2_RESTART_GAP_MS = 24000;
+inline bool sen6x_model_has_start_gap(Sen6xModel model) {
+  return model == Sen6xModel::SEN63C || model == Sen6xModel::SEN69C;
+}
+
+// One channel of a measured-values frame: word offset -> channel (scaling,
+// signedness and invalid sentinel come from SEN6X_CHANNEL_SCALES)
+struct Sen6xFrameField {
+  uint8_t word;
+  Sen6xChannel channel;
+};
+
+// Common layout: PM1.0[0], PM2.5[1], PM4.0[2], PM10.0[3], RH[4], T[5]
+#define SEN6X_COMMON_FRAME_FIELDS                                              \
+  {0, Sen6xChannel::PM_1_0}, {1, Sen6xChannel::PM_2_5},                        \
+      {2, Sen6xChannel::PM_4_0}, {3, Sen6xChannel::PM_10_0},                   \
+      {4, Sen6xChannel::HUMIDITY}, {5, Sen6xChannel::TEMPERATURE}
+
+// Compile-time frame layout per model (Datasheet v0.92 Table 26). Reads with
+// a model pinned in YAML (model:) use only that specialization;
+// SEN6X_PINNED_MODEL is defined by codegen when every instance pins the
+// same model. Otherwise the decoder dispatches on the detected model.
+template<Sen6xModel M> struct Sen6xModelTraits;
+
+template<> struct Sen6xModelTraits<Sen6xModel::SEN62> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN62;
+  static constexpr uint8_t WORDS = 6;
+  static constexpr Sen6xFrameField FIELDS[] = {SEN6X_COMMON_FRAME_FIELDS};
+};
+template<> struct Sen6xModelTraits<Sen6xModel::SEN63C> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN63C;
+  static constexpr uint8_t WORDS = 7;
+  static constexpr Sen6xFrameField FIELDS[] = {SEN6X_COMMON_FRAME_FIELDS,
+                                               {6, Sen6xChannel::CO2}};
+};
+template<> struct Sen6xModelTraits<Sen6xModel::SEN65> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN65;
+  static constexpr uint8_t WORDS = 8;
+  static constexpr Sen6xFrameField FIELDS[] = {SEN6X_COMMON_FRAME_FIELDS,
+                                               {6, Sen6xChannel::VOC_INDEX},
+                                               {7, Sen6xChannel::NOX_INDEX}};
+};
+template<> struct Sen6xModelTraits<Sen6xModel::SEN66> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN66;
+  static constexpr uint8_t WORDS = 9;
+  static constexpr Sen6xFrameField FIELDS[] = {
+      SEN6X_COMMON_FRAME_FIELDS, {6, Sen6xChannel::VOC_INDEX},
+      {7, Sen6xChannel::NOX_INDEX}, {8, Sen6xChannel::CO2}};
+};
+template<> struct Sen6xModelTraits<Sen6xModel::SEN68> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN68;
+  static constexpr uint8_t WORDS = 9;
+  static constexpr Sen6xFrameField FIELDS[] = {
+      SEN6X_COMMON_FRAME_FIELDS, {6, Sen6xChannel::VOC_INDEX},
+      {7, Sen6xChannel::NOX_INDEX}, {8, Sen6xChannel::FORMALDEHYDE}};
+};
+template<> struct Sen6xModelTraits<Sen6xModel::SEN69C> {
+  static constexpr uint16_t READ_COMMAND = SEN6X_CMD_READ_SEN69C;
+  static constexpr uint8_t WORDS = 10;
+  static constexpr Sen6xFrameField FIELDS[] = {
+      SEN6X_COMMON_FRAME_FIELDS,    {6, Sen6xChannel::VOC_INDEX},
+      {7, Sen6xChannel::NOX_INDEX}, {8, Sen6xChannel::FORMALDEHYDE},
+      {9, Sen6xChannel::CO2}};
+};
+
+#undef SEN6X_COMMON_FRAME_FIELDS
+
+// Model capabilities come from the frame tables above, so a check can never
+// disagree with what the decoder publishes
+template<Sen6xModel M>
+constexpr bool sen6x_model_has_channel(Sen6xChannel channel) {
+  for (const Sen6xFrameField &field : Sen6xModelTraits<M>::FIELDS) {
+    if (field.channel == channel)
+      return true;
+  }
+  return false;
+}
+inline bool sen6x_model_has_channel(Sen6xModel model, Sen6xChannel channel) {
+  switch (model) {
+  case Sen6xModel::SEN62:
+    return sen6x_model_has_channel<Sen6xModel::SEN62>(channel);
+  case Sen6xModel::SEN63C:
+    return sen6x_model_has_channel<Sen6xModel::SEN63C>(channel);
+  case Sen6xModel::SEN65:
+    return sen6x_model_has_channel<Sen6xModel::SEN65>(channel);
+  case Sen6xModel::SEN66:
+    return sen6x_model_has_channel<Sen6xModel::SEN66>(channel);
+  case Sen6xModel::SEN68:
+    return sen6x_model_has_channel<Sen6xModel::SEN68>(channel);
+  case Sen6xModel::SEN69C:
+    return sen6x_model_has_channel<Sen6xModel::SEN69C>(channel);
+  }
+  return false;
+}
+// CO2 channel, altitude compensation and CO2 ASC
+inline bool sen6x_model_has_co2(Sen6xModel model) {
+  return sen6x_model_has_channel(model, Sen6xChannel::CO2);
+}
+
+#ifdef USE_SEN6X_BUTTON
 class Sen6xButton : public esphome::button::Button {
 public:
   void set_press_callback(std::function<void()> &&callback) {
@@ -121,7 +574,9 @@ protected:
   }
   std::function<void()> callback_;
 };
+#endif
 
+#ifdef USE_SEN6X_NUMBER
 class Sen6xNumber : public esphome::number::Number {
 public:
   void set_control_callback(std::function<void(float)> &&callback) {
@@ -136,7 +591,9 @@ protected:
   }
   std::function<void(float)> callback_;
 };
+#endif
 
+#ifdef USE_SEN6X_SWITCH
 class Sen6xSwitch : public switch_::Switch {
 public:
   void set_write_callback(std::function<void(bool)> &&callback) {
@@ -152,15 +609,28 @@ protected:
   }
   std::function<void(bool)> callback_;
 };
+#endif
 
 class Sen6xComponent : public PollingComponent, public esphome::i2c::I2CDevice {
 public:
   void setup() override;
+  void loop() override;
   void update() override;
   void dump_config() override;
   float get_setup_priority() const override;
 
-  void set_model(Sen6xModel model) { model_ = model; }
+  // Boot state for other components: ready once configured and measuring
+  Sen6xBootPhase get_boot_phase() const { return boot_phase_; }
+  bool is_sensor_ready() const { return boot_phase_ == Sen6xBootPhase::READY; }
+  void add_on_ready_callback(std::function<void()> &&callback) {
+    ready_callback_.add(std::move(callback));
+  }
+
+  // Pins the model (YAML model:); auto-detection only verifies it
+  void set_model(Sen6xModel model) {
+    model_ = model;
+    model_pinned_ = true;
+  }
 
   void set_pm_1_0_sensor(esphome::sensor::Sensor *pm_1_0) {
     pm_1_0_sensor_ = pm_1_0;
@@ -198,6 +668,7 @@ public:
     sensor_altitude_sensor_ = sens;
   }
 
+#ifdef USE_SEN6X_TVOC
   void set_tvoc_well_sensor(sensor::Sensor *sens) { well_tvoc_sensor_ = sens; }
   void set_tvoc_reset_sensor(sensor::Sensor *sens) {
     reset_tvoc_sensor_ = sens;
@@ -205,18 +676,23 @@ public:
   void set_tvoc_ethanol_sensor(sensor::Sensor *sens) {
     tvoc_ethanol_sensor_ = sens;
   }
+#endif
 
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
   // Number Concentration sensors (particles/cm³)
   void set_nc_0_5_sensor(sensor::Sensor *sens) { nc_0_5_sensor_ = sens; }
   void set_nc_1_0_sensor(sensor::Sensor *sens) { nc_1_0_sensor_ = sens; }
   void set_nc_2_5_sensor(sensor::Sensor *sens) { nc_2_5_sensor_ = sens; }
   void set_nc_4_0_sensor(sensor::Sensor *sens) { nc_4_0_sensor_ = sens; }
   void set_nc_10_0_sensor(sensor::Sensor *sens) { nc_10_0_sensor_ = sens; }
+#endif
 
+#ifdef USE_SEN6X_TEXT_SENSOR
   // Firmware version text sensor
   void set_firmware_version_sensor(text_sensor::TextSensor *sens) {
     firmware_version_sensor_ = sens;
   }
+#endif
 
   void set_outdoor_co2_ppm(float ppm) { outdoor_co2_ppm_ = ppm; }
 
@@ -269,6 +745,7 @@ public:
     nox_tuning_ = tuning;
   }
 
+#ifdef USE_SEN6X_TEXT_SENSOR
   void set_product_name_text_sensor(esphome::text_sensor::TextSensor *sens) {
     product_name_text_sensor_ = sens;
   }
@@ -278,7 +755,19 @@ public:
   void set_status_text_sensor(esphome::text_sensor::TextSensor *sens) {
     status_text_sensor_ = sens;
   }
+  void set_bus_state_text_sensor(esphome::text_sensor::TextSensor *sens) {
+    bus_state_text_sensor_ = sens;
+  }
+#endif
+#ifdef USE_SEN6X_TELEMETRY
+  // One packed frame per cycle (see sen6x_telemetry.h)
+  void
+  set_telemetry_frame_text_sensor(esphome::text_sensor::TextSensor *sens) {
+    telemetry_.set_text_sensor(sens);
+  }
+#endif
 
+#ifdef USE_SEN6X_BINARY_SENSOR
   void set_fan_error_binary_sensor(esphome::binary_sensor::BinarySensor *sens) {
     fan_error_binary_sensor_ = sens;
   }
@@ -303,7 +792,13 @@ public:
       esphome::binary_sensor::BinarySensor *sens) {
     fan_cleaning_active_binary_sensor_ = sens;
   }
+  void set_bus_fault_binary_sensor(
+      esphome::binary_sensor::BinarySensor *sens) {
+    bus_fault_binary_sensor_ = sens;
+  }
+#endif
 
+#ifdef USE_SEN6X_BUTTON
   // Setters for Buttons
   void set_fan_cleaning_button(Sen6xButton *btn) { fan_cleaning_button_ = btn; }
   void set_device_reset_button(Sen6xButton *btn) { device_reset_button_ = btn; }
@@ -320,7 +815,10 @@ public:
   void set_clear_device_status_button(Sen6xButton *btn) {
     clear_device_status_button_ = btn;
   }
+  void set_dump_capture_button(Sen6xButton *btn) { dump_capture_button_ = btn; }
+#endif
 
+#ifdef USE_SEN6X_NUMBER
   // Setters for Numbers
   void set_altitude_compensation_number(Sen6xNumber *n) {
     altitude_compensation_number_ = n;
@@ -334,13 +832,159 @@ public:
   void set_outdoor_co2_reference_number(Sen6xNumber *n) {
     outdoor_co2_reference_number_ = n;
   }
+#endif
 
+#ifdef USE_SEN6X_SWITCH
   // Note: set_voc_tuning_switch removed - VOC tuning is now YAML-only
   void set_co2_asc_switch(Sen6xSwitch *sw) { co2_asc_switch_ = sw; }
   void set_auto_cleaning_switch(Sen6xSwitch *sw) { auto_cleaning_switch_ = sw; }
+  void set_burst_switch(Sen6xSwitch *sw) { burst_switch_ = sw; }
+#endif
+  // Fan runtime between two automatic cleanings
   void set_auto_cleaning_interval(uint32_t interval_ms) {
     auto_cleaning_interval_ms_ = interval_ms;
   }
+  // Quiet-period policy: a due cleaning waits for steady PM2.5 (stddev at
+  // or below max_pm_stddev, NAN = unused) and/or the time-of-day window,
+  // at most max_delay_ms
+  void set_auto_cleaning_quiet_period(float max_pm_stddev,
+                                      uint32_t max_delay_ms) {
+    quiet_max_pm_stddev_ = max_pm_stddev;
+    quiet_max_delay_ms_ = max_delay_ms;
+  }
+#ifdef USE_SEN6X_CLEANING_CLOCK
+  // Minutes after midnight; the window may wrap around midnight
+  void set_auto_cleaning_quiet_window(time::RealTimeClock *clock,
+                                      uint16_t start_minute,
+                                      uint16_t end_minute) {
+    quiet_clock_ = clock;
+    quiet_window_start_ = start_minute;
+    quiet_window_end_ = end_minute;
+  }
+#endif
+
+  // SHT heater cycle (button, schedule or lambda): Stop, heat 1s, read the
+  // heater RH/T back, restart measurement 20s after the activation
+  void activate_sht_heater();
+  // Periodic heater cycles, only while RH is at or above min_humidity
+  // (NAN = always)
+  void set_sht_heater_schedule(uint32_t interval_ms, float min_humidity) {
+    sht_heater_interval_ms_ = interval_ms;
+    sht_heater_min_humidity_ = min_humidity;
+  }
+#ifdef USE_SEN6X_HEATER_SENSORS
+  void set_heater_humidity_sensor(sensor::Sensor *sens) {
+    heater_humidity_sensor_ = sens;
+  }
+  void set_heater_temperature_sensor(sensor::Sensor *sens) {
+    heater_temperature_sensor_ = sens;
+  }
+#endif
+
+  // Forced CO2 recalibration to reference_ppm (NAN = outdoor CO2 reference),
+  // applied in the next idle window. False when rejected: no CO2 sensor, or
+  // the stability gate finds CO2 not settled.
+  bool start_forced_co2_calibration(float reference_ppm = NAN);
+  // Stability gate: the last 'samples' CO2 readings must lie within
+  // max_spread ppm and (unless NAN) their mean within max_deviation ppm of
+  // the reference
+  void set_co2_calibration_gate(uint8_t samples, uint16_t max_spread,
+                                float max_deviation) {
+    co2_stability_.configure(samples);
+    co2_max_spread_ = max_spread;
+    co2_max_deviation_ = max_deviation;
+  }
+#ifdef USE_SEN6X_CO2_CORRECTION
+  // Correction applied by the last successful FRC [ppm]
+  void set_co2_correction_sensor(sensor::Sensor *sens) {
+    co2_correction_sensor_ = sens;
+  }
+#endif
+
+  void set_polling_mode(Sen6xPollingMode mode) { polling_mode_ = mode; }
+
+  // Run a read group every N update() cycles (0 = never). Device Status is
+  // still read every cycle while a status flag is latched.
+  void set_decimation(Sen6xPollGroup group, uint8_t cycles) {
+    decimation_[static_cast<uint8_t>(group)] = cycles;
+  }
+
+  // Change-only publishing: per-channel deadband/heartbeat, and a global
+  // mode that suppresses identical values on channels without a deadband
+  void set_publish_filter(Sen6xChannel channel, float deadband,
+                          uint32_t heartbeat_ms) {
+    publish_filters_[static_cast<uint8_t>(channel)].deadband = deadband;
+    publish_filters_[static_cast<uint8_t>(channel)].heartbeat_ms =
+        heartbeat_ms;
+  }
+  void set_publish_on_change_only(bool enabled) {
+    publish_on_change_only_ = enabled;
+  }
+
+  // Windowed aggregation: buffer raw words and publish one statistic per
+  // channel every interval ('capacity' samples per window, max 255)
+  void set_aggregation(uint32_t interval_ms, uint8_t capacity) {
+    aggregation_interval_ms_ = interval_ms;
+    aggregation_capacity_ = capacity;
+  }
+  void set_channel_aggregate(Sen6xChannel channel, Sen6xAggregate aggregate) {
+    channel_aggregates_[static_cast<uint8_t>(channel)] = aggregate;
+  }
+
+  // Burst sampling: poll every 'interval_ms' for 'duration_ms' after a
+  // trigger (step threshold, switch or sen6x.start_burst action), then
+  // return to update_interval
+  void set_burst(uint32_t interval_ms, uint32_t duration_ms) {
+    burst_interval_ms_ = interval_ms;
+    burst_duration_ms_ = duration_ms;
+  }
+  void add_burst_trigger(Sen6xChannel channel, float step);
+  // Starts or extends a burst (0 = configured duration)
+  void start_burst(uint32_t duration_ms = 0);
+  void stop_burst();
+  bool is_burst_active() const { return burst_active_; }
+
+  // Rolling average of 'channel' over 'window_ms', kept in 'buckets' buckets
+  // and checkpointed to flash (survives reboots)
+  void add_rolling_average(Sen6xChannel channel, sensor::Sensor *sens,
+                           uint32_t window_ms, uint8_t buckets);
+
+  // Duty cycle: one stabilized sample every 'period_ms', measurement stopped
+  // in between. update_interval is the polling interval while awake.
+  void set_duty_cycle(uint32_t period_ms) { duty_period_ms_ = period_ms; }
+  void set_warm_up(Sen6xWarmUpGroup group, uint32_t warm_up_ms) {
+    warm_up_ms_[static_cast<uint8_t>(group)] = warm_up_ms;
+  }
+#ifdef USE_SEN6X_DUTY_RATIO
+  void set_duty_ratio_sensor(sensor::Sensor *sens) {
+    duty_ratio_sensor_ = sens;
+  }
+#endif
+
+  // Sensor task (ESP32): run the measurement cycle's bus reads on their own
+  // FreeRTOS task so I2C waits never block the main loop
+  void set_sensor_task(uint8_t core, uint8_t priority, uint32_t stack_size) {
+    sensor_task_core_ = core;
+    sensor_task_priority_ = priority;
+    sensor_task_stack_size_ = stack_size;
+  }
+
+  // Bus-fault circuit breaker (see Sen6xBreakerState)
+  void set_circuit_breaker(uint8_t threshold, uint32_t backoff_ms,
+                           uint32_t max_backoff_ms) {
+    breaker_threshold_ = threshold;
+    breaker_initial_backoff_ms_ = backoff_ms;
+    breaker_max_backoff_ms_ = max_backoff_ms;
+  }
+  Sen6xBreakerState get_breaker_state() const { return breaker_state_; }
+
+  // Per-loop bus time budget shared by all SEN6x instances (0 = unlimited)
+  void set_bus_time_budget(uint32_t budget_us);
+
+  // Debounce before idle-only changes are applied (coalesces slider drags)
+  void set_idle_window_debounce(uint32_t debounce_ms) {
+    idle_window_debounce_ms_ = debounce_ms;
+  }
 
   // Public method for external barometric sensor integration
   // Allows feeding pressure from BME280/BMP280/etc for CO2 compensation
@@ -351,26 +995,97 @@ public:
   void set_pressure_source(sensor::Sensor *source) {
     pressure_source_ = source;
   }
+  // External pressure pipeline: filter, then write at most every
+  // 'min_interval_ms' once the filtered value moved by 'hysteresis' hPa
+  void set_pressure_filter(Sen6xPressureFilterMode mode, float alpha,
+                           uint8_t window) {
+    pressure_filter_.configure(mode, alpha, window);
+  }
+  void set_pressure_rate_limit(uint32_t min_interval_ms, float hysteresis) {
+    pressure_min_interval_ms_ = min_interval_ms;
+    pressure_hysteresis_ = hysteresis;
+  }
 
   // Store baseline configuration (same as SEN5x official)
   void set_store_baseline(bool store_baseline) {
     store_baseline_ = store_baseline;
   }
+  void set_baseline_store_policy(uint32_t min_interval_ms, uint32_t max_diff) {
+    baseline_store_interval_ms_ = min_interval_ms;
+    baseline_store_diff_ = max_diff;
+  }
+  // I2C / update() instrumentation (see sen6x_diagnostics.h)
+  void set_diagnostic_sensor(Sen6xDiagnosticSensor id, sensor::Sensor *sens) {
+    diagnostics_.set_sensor(id, sens);
+  }
+  void set_diagnostics_interval(uint32_t interval_ms) {
+    diagnostics_interval_ms_ = interval_ms;
+  }
+
+  // Raw response capture (see sen6x_capture.h)
+  void set_capture_buffer_size(uint16_t size) { capture_buffer_size_ = size; }
+  // Logs the captured records as SEN6XCAP lines, oldest first
+  void dump_capture();
+  // Feeds one captured response through the decoder as if it had just been
+  // read from the bus (no I2C traffic)
+  void replay_response(uint16_t command, const uint16_t *data, uint8_t words);
+
+#ifdef USE_SEN6X_FLASH_WRITES
+  // Configuration record writes since boot
+  void set_flash_writes_sensor(sensor::Sensor *sens) {
+    flash_writes_sensor_ = sens;
+  }
+#endif
 
   // RHT Acceleration configuration (YAML-only, volatile - applied on each boot)
   void set_rht_acceleration(RhtAcceleration rht) { rht_acceleration_ = rht; }
 
+  // Writes pending configuration changes before a reboot
+  void on_shutdown() override;
+
 protected:
+  // Boot sequence steps (see Sen6xBootPhase)
+  void boot_configure_();
+  void boot_apply_idle_configuration_();
+  void boot_post_start_();
+  void register_control_callbacks_();
+  Sen6xBootPhase boot_phase_{Sen6xBootPhase::STOPPING};
+  CallbackManager<void()> ready_callback_;
+
+  // Identity strings go into identity_ (fixed buffers, no heap)
   void read_device_identity_();
+  void finish_device_identity_(bool firmware_valid);
+  void handle_product_name_(const char *product_name);
+  void apply_model_(Sen6xModel detected);
+  void publish_identity_(bool firmware_valid);
+  Sen6xIdentityRecord identity_{};
+  bool serial_number_valid_{false}; // Read during boot_configure_()
   void read_device_status_();
   void read_device_configuration_();
 
   // Action Helpers
   void start_fan_cleaning_();
-  void continue_fan_cleaning_();
+  void finish_fan_cleaning_(bool cleaned);
+  void abort_fan_cleaning_();
+#ifdef USE_SEN6X_BUTTON
   void execute_device_reset_();
+  void execute_preferences_reset_();
+#endif
+  bool reconfigure_active_{false}; // Device reset or reapply in progress
+  bool perform_forced_co2_calibration_(uint16_t reference_ppm);
+  bool co2_settled_(float reference_ppm) const;
+  Sen6xCo2Stability co2_stability_;
+  uint16_t co2_max_spread_{0};
+  float co2_max_deviation_{NAN};
+#ifdef USE_SEN6X_CO2_CORRECTION
+  sensor::Sensor *co2_correction_sensor_{nullptr};
+#endif
   bool write_altitude_compensation_(float altitude);
-  bool write_ambient_pressure_compensation_(float pressure);
+  // 'persist' = store in the configuration record (manual setting),
+  // 'feed' = external pressure pipeline, recorded once acknowledged
+  bool write_ambient_pressure_compensation_(float pressure,
+                                            bool persist = true,
+                                            bool feed = false);
   bool write_temperature_offset_(float offset);
   bool
   write_temperature_compensation_(const TemperatureCompensation &compensation);
@@ -378,9 +1093,39 @@ protected:
   bool write_nox_algorithm_tuning_(const GasTuning &tuning);
   bool write_rht_acceleration_(const RhtAcceleration &rht);
   bool write_co2_asc_(bool enabled);
-  bool perform_forced_co2_calibration_(uint16_t reference_ppm);
   void configure_auto_cleaning_(bool enabled);
-  void execute_preferences_reset_();
+
+  // Idle configuration window (single Stop -> writes -> Start per batch)
+  void request_idle_configuration_(Sen6xIdleAction action, float value = 0.0f);
+  void open_idle_window_();
+  void close_idle_window_();
+  void finish_idle_window_();
+  void abort_idle_window_();
+  Sen6xIdleRequest
+      idle_requests_[static_cast<uint8_t>(Sen6xIdleAction::COUNT)]{};
+  Sen6xIdleAction
+      idle_request_order_[static_cast<uint8_t>(Sen6xIdleAction::COUNT)]{};
+  uint8_t idle_request_count_{0};
+  // Actions of the open window, re-queued if a bus fault interrupts it
+  Sen6xIdleAction
+      idle_window_order_[static_cast<uint8_t>(Sen6xIdleAction::COUNT)]{};
+  uint8_t idle_window_count_{0};
+  bool idle_window_active_{false};
+  uint32_t idle_window_debounce_ms_{2000};
+
+  // SHT heater cycle inside the idle window (see activate_sht_heater())
+  void poll_sht_heater_();
+  void finish_sht_heater_(float humidity, float temperature);
+  void run_scheduled_sht_heater_();
+  uint32_t sht_heater_interval_ms_{0};
+  float sht_heater_min_humidity_{NAN};
+  uint8_t sht_heater_polls_{0};
+  uint32_t sht_heater_activated_ms_{0};
+  float ambient_humidity_{NAN}; // Last frame RH (schedule condition)
+#ifdef USE_SEN6X_HEATER_SENSORS
+  sensor::Sensor *heater_humidity_sensor_{nullptr};
+  sensor::Sensor *heater_temperature_sensor_{nullptr};
+#endif
 
   sensor::Sensor *pm_1_0_sensor_{nullptr};
   sensor::Sensor *pm_2_5_sensor_{nullptr};
@@ -396,22 +1141,29 @@ protected:
   sensor::Sensor *ambient_pressure_sensor_{nullptr};
   sensor::Sensor *sensor_altitude_sensor_{nullptr};
 
+#ifdef USE_SEN6X_TVOC
   sensor::Sensor *well_tvoc_sensor_{nullptr};
   sensor::Sensor *reset_tvoc_sensor_{nullptr};
   sensor::Sensor *tvoc_ethanol_sensor_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
   // Number Concentration sensors (particles/cm³)
   sensor::Sensor *nc_0_5_sensor_{nullptr};
   sensor::Sensor *nc_1_0_sensor_{nullptr};
   sensor::Sensor *nc_2_5_sensor_{nullptr};
   sensor::Sensor *nc_4_0_sensor_{nullptr};
   sensor::Sensor *nc_10_0_sensor_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_TEXT_SENSOR
   // Firmware version text sensor
   text_sensor::TextSensor *firmware_version_sensor_{nullptr};
+#endif
 
   float outdoor_co2_ppm_{400.0f};
   Sen6xModel model_{Sen6xModel::SEN66}; // Default to SEN66
+  bool model_pinned_{false};             // model: set in YAML
   sensor::Sensor *pressure_source_{
       nullptr}; // External pressure sensor for CO2 compensation
 
@@ -423,10 +1175,14 @@ protected:
   bool fan_cleaning_active_state_{false};
   uint32_t last_fan_cleaning_end_time_{0};
 
+#ifdef USE_SEN6X_TEXT_SENSOR
   text_sensor::TextSensor *product_name_text_sensor_{nullptr};
   text_sensor::TextSensor *serial_number_text_sensor_{nullptr};
   text_sensor::TextSensor *status_text_sensor_{nullptr};
+  text_sensor::TextSensor *bus_state_text_sensor_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_BINARY_SENSOR
   binary_sensor::BinarySensor *fan_error_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *fan_warning_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *gas_error_binary_sensor_{nullptr};
@@ -434,7 +1190,10 @@ protected:
   binary_sensor::BinarySensor *pm_error_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *laser_error_binary_sensor_{nullptr};
   binary_sensor::BinarySensor *fan_cleaning_active_binary_sensor_{nullptr};
+  binary_sensor::BinarySensor *bus_fault_binary_sensor_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_BUTTON
   Sen6xButton *fan_cleaning_button_{nullptr};
   Sen6xButton *device_reset_button_{nullptr};
   Sen6xButton *reset_preferences_button_{nullptr};
@@ -442,31 +1201,84 @@ protected:
   Sen6xButton *co2_factory_reset_button_{nullptr};
   Sen6xButton *sht_heater_button_{nullptr};
   Sen6xButton *clear_device_status_button_{nullptr};
+  Sen6xButton *dump_capture_button_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_NUMBER
   Sen6xNumber *altitude_compensation_number_{nullptr};
   Sen6xNumber *ambient_pressure_compensation_number_{nullptr};
   Sen6xNumber *temperature_offset_number_{nullptr};
   Sen6xNumber *outdoor_co2_reference_number_{nullptr};
+#endif
 
+#ifdef USE_SEN6X_SWITCH
   // voc_tuning_switch_ removed - now YAML-only under
   // sensor/voc_index/algorithm_tuning
   Sen6xSwitch *co2_asc_switch_{nullptr};
   Sen6xSwitch *auto_cleaning_switch_{nullptr};
+  Sen6xSwitch *burst_switch_{nullptr};
+#endif
   uint32_t auto_cleaning_interval_ms_{604800000}; // Default 7 days in ms
 
-  ESPPreferenceObject altitude_preference_;
-  ESPPreferenceObject ambient_pressure_preference_;
-  ESPPreferenceObject temperature_offset_preference_;
-  // voc_tuning_preference_ removed - no persistence needed for YAML-only config
-  ESPPreferenceObject co2_asc_preference_;
-  ESPPreferenceObject auto_cleaning_preference_;
-  ESPPreferenceObject outdoor_co2_reference_preference_;
+  // Runtime-based auto cleaning (see sen6x_cleaning.h). Runtime is sampled
+  // every SEN6X_FAN_RUNTIME_TICK_MS; the record is written at most every
+  // SEN6X_FAN_RUNTIME_CHECKPOINT_MS outside of cleanings and shutdown.
+  bool fan_running_() const;
+  void tick_fan_runtime_();
+  void check_auto_cleaning_due_();
+  bool auto_cleaning_quiet_now_(const char **reason);
+  void load_cleaning_record_();
+  void save_cleaning_record_();
+  ESPPreferenceObject cleaning_preference_;
+  Sen6xCleaningRecord cleaning_record_{};
+  bool cleaning_record_dirty_{false};
+  uint32_t last_cleaning_save_ms_{0};
+  uint32_t last_runtime_tick_ms_{0};
+  uint32_t runtime_remainder_ms_{0};
+  bool cleaning_due_{false};
+  uint32_t cleaning_due_since_ms_{0};
+  Sen6xQuietDetector quiet_detector_;
+  float quiet_max_pm_stddev_{NAN};
+  uint32_t quiet_max_delay_ms_{86400000}; // 24 h
+#ifdef USE_SEN6X_CLEANING_CLOCK
+  time::RealTimeClock *quiet_clock_{nullptr};
+  uint16_t quiet_window_start_{0};
+  uint16_t quiet_window_end_{0};
+#endif
+
+  // Persisted configuration (see Sen6xConfigRecord). Changes only mark the
+  // record dirty; it is written once after SEN6X_CONFIG_COMMIT_DELAY_MS.
+  void load_config_();
+  uint16_t load_legacy_config_(); // Bit per migrated hash offset
+  void invalidate_legacy_config_(uint16_t offsets);
+  void reset_config_();
+  void mark_config_dirty_();
+  bool commit_config_();
+  template<typename T> void update_config_(T &field, const T &value) {
+    // Bitwise compare, so NAN -> NAN is not a change
+    if (std::memcmp(&field, &value, sizeof(T)) == 0)
+      return;
+    field = value;
+    this->mark_config_dirty_();
+  }
+  ESPPreferenceObject config_preference_;
+  Sen6xConfigRecord config_{};
+  bool config_dirty_{false};
+
+  void record_flash_write_();
+  uint32_t flash_write_count_{0};
+#ifdef USE_SEN6X_FLASH_WRITES
+  sensor::Sensor *flash_writes_sensor_{nullptr};
+#endif
 
-  // VOC baseline persistence (same as SEN5x official)
+  // VOC baseline persistence (same as SEN5x official), read in the
+  // background once min_interval has passed since the last store
+  void check_voc_baseline_();
   bool store_baseline_{true}; // Default: true
-  Sen6xBaselines voc_baselines_storage_{0, 0};
-  ESPPreferenceObject voc_baseline_preference_;
-  uint32_t seconds_since_last_baseline_store_{0};
+  uint32_t baseline_store_interval_ms_{SHORTEST_BASELINE_STORE_INTERVAL * 1000};
+  uint32_t baseline_store_diff_{MAXIMUM_STORAGE_DIFF};
+  uint32_t last_baseline_store_ms_{0};
+  uint32_t last_baseline_check_ms_{0};
 
   // Preference hash (based on serial number, same as SEN5x official)
   // Ensures unique storage per sensor, avoiding conflicts with multiple sensors
@@ -475,26 +1287,255 @@ protected:
   // RHT Acceleration configuration (YAML-only, volatile)
   optional<RhtAcceleration> rht_acceleration_;
 
-  // Deferred restore state (apply after first successful measurement)
+  // Altitude restored from NVS at boot (NAN = none restored)
   float pending_altitude_{NAN};
-  float pending_temp_offset_{NAN};
-  bool altitude_restored_{false};
-  bool temp_offset_restored_{false};
+  bool first_update_{true};           // One-time diagnostic log in update()
+  // External pressure pipeline (set_ambient_pressure() -> filter -> rate
+  // limit -> transaction queue)
+  void schedule_pressure_write_();
+  void flush_pressure_write_();
+  bool pressure_write_needed_() const;
+  Sen6xPressureFilter pressure_filter_;
+  float pressure_filtered_{NAN};      // [hPa]
+  float last_written_pressure_{NAN};  // External pressure last sent [hPa]
+  uint32_t last_pressure_write_ms_{0};
+  uint32_t pressure_min_interval_ms_{SEN6X_DEFAULT_PRESSURE_MIN_INTERVAL_MS};
+  float pressure_hysteresis_{SEN6X_DEFAULT_PRESSURE_HYSTERESIS};
+  bool pressure_write_pending_{false}; // Timeout armed or write in flight
 
   enum ErrorCode {
     NONE = 0,
     COMMUNICATION_FAILED,
     CRC_CHECK_FAILED,
   } error_code_{NONE};
-  bool start_measurement_();
+  // Every Start/Stop goes through these: they track the measurement run
+  // (FRC needs 3 min of it) and reset the CO2 stability window. 'done'
+  // (optional) replaces the default failure log.
+  bool start_measurement_(Sen6xTransactionCallback &&done = nullptr);
+  bool stop_measurement_(Sen6xTransactionCallback &&done = nullptr);
+  uint32_t measurement_start_ms_{0};
+  bool measurement_running_{false};
+  uint32_t last_start_ms_{0}; // Start queued, then completed (restart gap)
+  bool start_sent_{false};
+  // SEN63C/SEN69C restart gap: one deferred Start at most. Every caller's
+  // 'done' waits in start_waiters_ and is answered by the next Start sent;
+  // a Stop or an idle window only cancels the timer.
+  void cancel_deferred_start_();
+  Sen6xTransactionCallback start_waiters_;
+  bool start_deferred_{false}; // "start_measurement" timeout armed
   bool write_command_(uint16_t command);
-  bool write_command_with_data_(uint16_t command, uint16_t data); // New helper
+  bool write_command_with_words_(uint16_t command, const uint16_t *data,
+                                 uint8_t words);
+
+  // Every I2C transfer goes through these (timed and counted per command)
+  i2c::ErrorCode bus_write_(uint16_t command, const uint8_t *data,
+                            size_t len);
+  i2c::ErrorCode bus_read_(uint16_t command, uint8_t *data, size_t len);
+  Sen6xDiagnostics diagnostics_;
+  // Packed per-cycle frame, published when the cycle ends
+  Sen6xTelemetry telemetry_;
+  void publish_telemetry_();
+  uint32_t diagnostics_interval_ms_{SEN6X_DEFAULT_DIAGNOSTICS_INTERVAL_MS};
+
+#ifdef USE_SEN6X_CAPTURE
+  void capture_(uint16_t command, const uint16_t *data, uint8_t words,
+                uint32_t timestamp_ms = millis()) {
+    capture_ring_.record(timestamp_ms, command, data, words);
+  }
+  Sen6xCaptureRing capture_ring_;
+#else
+  void capture_(uint16_t command, const uint16_t *data, uint8_t words,
+                uint32_t timestamp_ms = 0) {}
+#endif
+  uint16_t capture_buffer_size_{SEN6X_DEFAULT_CAPTURE_BUFFER_SIZE};
 
-  // Helpers
-  bool read_bytes_(uint16_t command, uint8_t *buffer, uint8_t len);
-  bool read_words_(uint16_t command, uint16_t *data, uint8_t words);
-  bool read_measurement_data_(uint16_t *data, uint8_t len);
+  uint16_t get_measurement_command_();    // Returns read command for model
   uint8_t get_measurement_word_count_(); // Returns word count based on model
+
+  // Asynchronous transaction engine (driven from loop())
+  bool queue_read_(uint16_t command, uint8_t words,
+                   Sen6xTransactionCallback &&callback,
+                   uint16_t execution_time_ms = SEN6X_DEFAULT_EXECUTION_TIME_MS);
+  bool queue_write_(uint16_t command, const uint16_t *payload,
+                    uint8_t payload_words,
+                    Sen6xTransactionCallback &&callback = nullptr,
+                    uint16_t execution_time_ms = SEN6X_DEFAULT_EXECUTION_TIME_MS);
+  bool queue_transaction_(Sen6xTransaction &&transaction);
+  void process_transactions_();
+  bool transaction_bus_pending_() const;
+  uint8_t bus_slot_{0}; // Slot in the shared bus scheduler
+  void complete_transaction_();
+
+  enum class TransactionState : uint8_t {
+    IDLE,    // Nothing on the wire
+    WAITING, // Command written, waiting execution time before read
+  };
+  Sen6xTransaction transaction_queue_[SEN6X_TRANSACTION_QUEUE_SIZE];
+  uint8_t transaction_head_{0};
+  uint8_t transaction_count_{0};
+  TransactionState transaction_state_{TransactionState::IDLE};
+  uint32_t transaction_started_ms_{0};
+  uint16_t response_words_[SEN6X_MAX_RESPONSE_WORDS]{};
+
+  // Measurement cycle (status -> data ready -> frame -> NC), one at a time
+  bool measurement_cycle_active_{false};
+  void read_measurement_data_();
+  void handle_measurement_data_(const uint16_t *data, uint8_t words);
+  template<Sen6xModel M>
+  void decode_frame_(const uint16_t *data, uint8_t words);
+  void read_number_concentration_();
+  bool number_concentration_wanted_() const; // Any NC consumer configured
+#ifdef USE_SEN6X_NUMBER_CONCENTRATION
+  void handle_number_concentration_(const uint16_t *data, uint8_t words);
+#endif
+  void handle_device_status_(uint32_t device_status);
+  bool status_poll_due_();
+  uint32_t last_device_status_{0};
+  bool device_status_valid_{false};
+
+  // Per-group decimation (indexed by Sen6xPollGroup)
+  bool poll_group_due_(Sen6xPollGroup group, bool force = false);
+  uint8_t decimation_[static_cast<uint8_t>(Sen6xPollGroup::COUNT)]{1, 1, 1, 0};
+  uint8_t decimation_counter_[static_cast<uint8_t>(Sen6xPollGroup::COUNT)]{};
+  bool cycle_reads_nc_{true}; // NC group due in the current cycle
+
+  // Publishes 'value' unless it is within the channel's deadband (and no
+  // heartbeat is due)
+  void publish_channel_(Sen6xChannel channel, esphome::sensor::Sensor *sens,
+                        float value);
+  Sen6xPublishFilter
+      publish_filters_[static_cast<uint8_t>(Sen6xChannel::COUNT)]{};
+  bool publish_on_change_only_{false};
+
+  // Decode (or buffer) a raw channel word, then publish through the filter
+  void emit_channel_(Sen6xChannel channel, uint16_t raw);
+  esphome::sensor::Sensor *channel_sensor_(Sen6xChannel channel);
+  void publish_tvoc_estimates_(const Sen6xDerivedMetrics &metrics);
+
+  // Windowed aggregation (raw fixed-point rings, see sen6x_aggregation.h)
+  bool aggregation_enabled_() const { return aggregation_interval_ms_ > 0; }
+  void setup_aggregation_();
+  void publish_aggregates_();
+  uint32_t aggregation_interval_ms_{0};
+  uint8_t aggregation_capacity_{0};
+  Sen6xSampleRing sample_rings_[static_cast<uint8_t>(Sen6xChannel::COUNT)];
+  Sen6xAggregate
+      channel_aggregates_[static_cast<uint8_t>(Sen6xChannel::COUNT)]{};
+
+  // Burst sampling (USE_SEN6X_BURST)
+  void check_burst_triggers_(Sen6xChannel channel, uint16_t raw);
+  void set_effective_update_interval_(uint32_t interval_ms);
+  uint32_t burst_interval_ms_{SEN6X_DEFAULT_BURST_INTERVAL_MS};
+  uint32_t burst_duration_ms_{SEN6X_DEFAULT_BURST_DURATION_MS};
+  uint32_t baseline_update_interval_ms_{0}; // update_interval from YAML
+  bool burst_active_{false};
+#ifdef USE_SEN6X_BURST
+  Sen6xBurstTrigger burst_triggers_[SEN6X_MAX_BURST_TRIGGERS];
+#endif
+
+  // Bus-fault circuit breaker. Results are counted in the transaction
+  // engine once boot is READY (a sensor missing at boot still fails setup).
+  void record_bus_result_(bool ok);
+  void trip_breaker_();
+  void probe_bus_();
+  void recover_from_bus_fault_();
+  void reapply_volatile_configuration_(); // Stop, then the writes below
+  void apply_volatile_configuration_();
+  void restore_voc_baseline_(); // Idle mode, from the configuration record
+  void fail_queued_transactions_();
+  void publish_breaker_state_();
+  uint8_t breaker_threshold_{SEN6X_DEFAULT_BREAKER_THRESHOLD};
+  uint32_t breaker_initial_backoff_ms_{SEN6X_DEFAULT_BREAKER_BACKOFF_MS};
+  uint32_t breaker_max_backoff_ms_{SEN6X_DEFAULT_BREAKER_MAX_BACKOFF_MS};
+  uint32_t breaker_backoff_ms_{0}; // Current backoff (doubles per probe)
+  uint8_t consecutive_bus_failures_{0};
+  uint32_t breaker_trips_{0};
+  Sen6xBreakerState breaker_state_{Sen6xBreakerState::CLOSED};
+
+  // Rolling window averages (USE_SEN6X_ROLLING_AVERAGE). Checkpoints are
+  // loaded once preference_hash_ is known.
+  void feed_rolling_average_(Sen6xChannel channel, float value);
+  void load_rolling_averages_();
+  void save_rolling_averages_();
+#ifdef USE_SEN6X_ROLLING_AVERAGE
+  Sen6xRollingAverage rolling_averages_[SEN6X_MAX_ROLLING_AVERAGES];
+#endif
+
+  // Sensor task (USE_SEN6X_SENSOR_TASK). The main loop owns everything but
+  // the bus while task_busy_ is set; samples come back through the ring.
+  uint8_t sensor_task_core_{SEN6X_DEFAULT_TASK_CORE};
+  uint8_t sensor_task_priority_{SEN6X_DEFAULT_TASK_PRIORITY};
+  uint32_t sensor_task_stack_size_{SEN6X_DEFAULT_TASK_STACK_SIZE};
+#ifdef USE_SEN6X_SENSOR_TASK
+  static void sensor_task_entry_(void *arg);
+  void sensor_task_loop_();
+  // Task side: blocking write -> wait -> read + CRC, no logging. Bus
+  // activity is counted into 'stats', never into diagnostics_.
+  Sen6xTaskResult task_read_(uint16_t command, uint16_t *data, uint8_t words,
+                             Sen6xBusStats &stats);
+  void push_task_sample_(uint16_t command, Sen6xTaskResult result,
+                         const uint16_t *data, uint8_t words,
+                         const Sen6xBusStats &bus,
+                         const Sen6xBusStats &probe = {});
+  // Main side
+  void request_task_cycle_();  // From update(): record the cycle's reads
+  bool service_sensor_task_(); // From loop(): true while the task owns bus
+  void drain_task_samples_();
+  TaskHandle_t sensor_task_{nullptr};
+  Sen6xSpscRing<Sen6xTaskSample, SEN6X_TASK_RING_SIZE> task_samples_;
+  std::atomic<bool> task_busy_{false};
+  std::atomic<uint32_t> task_dropped_samples_{0};
+  bool task_cycle_in_flight_{false}; // Main only
+  uint32_t task_request_{0};         // Pending SEN6X_TASK_READ_* mask
+  // Written by the main loop before the notify, read by the task after it
+  uint16_t task_frame_command_{0};
+  uint8_t task_frame_words_{0};
+#endif
+
+  // Duty-cycled measurement (USE_SEN6X_DUTY_CYCLE)
+  void begin_duty_cycle_();
+  void enter_duty_sleep_();
+  void wake_duty_cycle_();
+  // Measurement cycle end: telemetry, then sleep once a frame was stable
+  void end_measurement_cycle_();
+  // Restarts measurement after cleaning/reset unless duty-cycle sleeping
+  void resume_measurement_();
+  bool duty_sleeping_() const {
+    return duty_state_ == Sen6xDutyState::SLEEPING;
+  }
+#ifdef USE_SEN6X_DUTY_CYCLE
+  bool duty_channel_warm_(Sen6xChannel channel) const;
+#else
+  bool duty_channel_warm_(Sen6xChannel channel) const { return true; }
+#endif
+  uint32_t duty_period_ms_{0};
+  uint32_t warm_up_ms_[static_cast<uint8_t>(Sen6xWarmUpGroup::COUNT)]{
+      SEN6X_DEFAULT_WARM_UP_MS[0], SEN6X_DEFAULT_WARM_UP_MS[1],
+      SEN6X_DEFAULT_WARM_UP_MS[2], SEN6X_DEFAULT_WARM_UP_MS[3],
+      SEN6X_DEFAULT_WARM_UP_MS[4]};
+  Sen6xDutyState duty_state_{Sen6xDutyState::CONTINUOUS};
+  uint32_t duty_wake_ms_{0};        // Measurement start of this period
+  uint32_t duty_last_awake_ms_{0};  // Awake time of the previous period
+  bool duty_frame_stable_{false};   // Every consumed channel published
+#ifdef USE_SEN6X_DUTY_RATIO
+  sensor::Sensor *duty_ratio_sensor_{nullptr};
+#endif
+
+  // Phase-locked polling (polling_mode: PHASE_LOCKED)
+  Sen6xPollingMode polling_mode_{Sen6xPollingMode::INTERVAL};
+  void schedule_phase_locked_read_();
+  void probe_data_ready_phase_();
+  void on_data_ready_edge_(uint32_t now);
+  void reset_phase_lock_();
+  bool phase_locked_{false};
+  bool phase_anchor_valid_{false};
+  bool phase_seen_not_ready_{false};
+  bool phase_frame_pending_{false}; // Current cycle still needs its frame
+  uint8_t phase_probe_count_{0};
+  uint8_t phase_reads_since_lock_{0};
+  uint32_t phase_anchor_ms_{0}; // Latest known data-ready edge (upper bound)
+  uint32_t phase_origin_ms_{0}; // Last measured edge (period estimation)
+  float phase_period_ms_{SEN6X_MEASUREMENT_PERIOD_MS}; // Measured cadence
 };
 
 } // namespace sen6x
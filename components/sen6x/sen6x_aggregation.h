@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Fixed-point sample ring and windowed statistics (mean/min/max/stddev).
+// Samples are kept as the raw 16-bit words from the sensor; scaling to
+// engineering units only happens once per published aggregate.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+// Statistic published for a channel at the end of each window
+enum class Sen6xAggregate : uint8_t {
+  MEAN = 0,
+  MIN,
+  MAX,
+  STDDEV,
+  LAST,
+};
+
+// Integer statistics over a window, in raw sensor counts
+struct Sen6xWindowStats {
+  uint8_t count;
+  int32_t min;
+  int32_t max;
+  int32_t last;
+  int64_t sum;
+  int64_t sum_squares;
+
+  float mean() const { return count > 0 ? (float)sum / count : NAN; }
+  float stddev() const {
+    if (count == 0)
+      return NAN;
+    // n * sum(x^2) - sum(x)^2 is exact in 64-bit for up to 255 samples
+    int64_t variance_scaled = (int64_t)count * sum_squares - sum * sum;
+    if (variance_scaled <= 0)
+      return 0.0f;
+    return std::sqrt((float)variance_scaled) / count;
+  }
+  float get(Sen6xAggregate aggregate) const {
+    if (count == 0)
+      return NAN;
+    switch (aggregate) {
+    case Sen6xAggregate::MIN:
+      return (float)min;
+    case Sen6xAggregate::MAX:
+      return (float)max;
+    case Sen6xAggregate::STDDEV:
+      return stddev();
+    case Sen6xAggregate::LAST:
+      return (float)last;
+    case Sen6xAggregate::MEAN:
+    default:
+      return mean();
+    }
+  }
+};
+
+// Ring of raw words for one channel. Storage is allocated once (setup) and
+// holds the newest 'capacity' samples of the current window.
+class Sen6xSampleRing {
+public:
+  void allocate(uint8_t capacity) {
+    if (this->samples_ != nullptr || capacity == 0)
+      return;
+    this->samples_ = new uint16_t[capacity]; // NOLINT
+    this->capacity_ = capacity;
+  }
+  bool is_allocated() const { return this->samples_ != nullptr; }
+
+  void push(uint16_t raw) {
+    if (this->samples_ == nullptr)
+      return;
+    this->samples_[this->head_] = raw;
+    this->head_ = (this->head_ + 1) % this->capacity_;
+    if (this->count_ < this->capacity_)
+      this->count_++;
+  }
+
+  // Statistics over the buffered window; 'is_signed' selects int16 decoding
+  Sen6xWindowStats stats(bool is_signed) const {
+    Sen6xWindowStats stats{};
+    stats.count = this->count_;
+    for (uint8_t i = 0; i < this->count_; i++) {
+      // Oldest to newest
+      uint8_t index =
+          (this->head_ + this->capacity_ - this->count_ + i) % this->capacity_;
+      uint16_t raw = this->samples_[index];
+      int32_t value = is_signed ? (int32_t)(int16_t)raw : (int32_t)raw;
+      if (i == 0 || value < stats.min)
+        stats.min = value;
+      if (i == 0 || value > stats.max)
+        stats.max = value;
+      stats.last = value;
+      stats.sum += value;
+      stats.sum_squares += (int64_t)value * value;
+    }
+    return stats;
+  }
+
+  // Buffered words in storage order (not oldest to newest); for
+  // order-independent passes such as the TVOC window mean
+  const uint16_t *samples() const { return this->samples_; }
+  uint8_t count() const { return this->count_; }
+
+  // Starts the next window (from slot 0, so samples() holds count() words)
+  void clear() {
+    this->count_ = 0;
+    this->head_ = 0;
+  }
+
+protected:
+  uint16_t *samples_{nullptr};
+  uint8_t capacity_{0};
+  uint8_t head_{0};
+  uint8_t count_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Shared bus-time scheduler for multiple SEN6x instances (multiple buses,
+// TCA9548A mux channels). Each loop iteration has a bus time budget; an
+// instance denied in one loop gets priority in the next, so no instance
+// starves regardless of component loop order.
+
+#pragma once
+
+#include "esphome/core/component.h"
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+static const uint8_t SEN6X_BUS_SCHEDULER_MAX_DEVICES = 16;
+static const uint32_t SEN6X_DEFAULT_BUS_TIME_BUDGET_US =
+    4000; // ~1 SEN69C frame read at 100kHz
+
+// Registered once as a component (codegen). Components loop in setup
+// priority order, so its loop() opens every main-loop pass before any SEN6x
+// instance asks for bus time.
+class Sen6xBusScheduler : public Component {
+public:
+  void loop() override { this->roll_over_(); }
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  // Returns the slot used for all later calls (one per instance)
+  uint8_t register_device();
+
+  // Shared budget of all instances; 0 disables scheduling
+  void set_budget_us(uint32_t budget_us) { budget_us_ = budget_us; }
+  uint32_t get_budget_us() const { return budget_us_; }
+  uint8_t get_device_count() const { return device_count_; }
+
+  // Ask for bus time in the current loop iteration. The budget is checked
+  // before the operation, so per-loop bus time is bounded by the budget
+  // plus one transaction.
+  bool acquire(uint8_t slot);
+  // Report bus time actually used after a granted acquire()
+  void release(uint8_t slot, uint32_t used_us);
+
+protected:
+  void roll_over_();
+
+  uint32_t budget_us_{SEN6X_DEFAULT_BUS_TIME_BUDGET_US};
+  uint8_t device_count_{0};
+
+  // Current loop iteration, advanced by loop()
+  uint32_t loop_id_{1};
+  uint32_t used_us_{0};
+
+  // Devices denied in the previous loop are served first in the next
+  uint32_t denied_loop_[SEN6X_BUS_SCHEDULER_MAX_DEVICES]{};
+  bool denied_[SEN6X_BUS_SCHEDULER_MAX_DEVICES]{};
+  uint8_t priority_pending_{0};
+};
+
+extern Sen6xBusScheduler global_sen6x_bus_scheduler; // NOLINT
+
+} // namespace sen6x
+} // namespace esphome
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Stability gate for forced CO2 recalibration. FRC trusts the reference
+// blindly, so a calibration started while CO2 is still moving (window just
+// closed, people leaving) bakes the error into the sensor. The gate keeps
+// the last samples and only allows FRC once their min/max spread (and,
+// optionally, their mean's distance to the reference) is small enough.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+static const uint8_t SEN6X_CO2_STABILITY_MAX_SAMPLES = 30;
+
+class Sen6xCo2Stability {
+public:
+  void configure(uint8_t samples) {
+    if (samples < 2)
+      samples = 2;
+    if (samples > SEN6X_CO2_STABILITY_MAX_SAMPLES)
+      samples = SEN6X_CO2_STABILITY_MAX_SAMPLES;
+    this->size_ = samples;
+    this->reset();
+  }
+  bool enabled() const { return this->size_ > 0; }
+  uint8_t size() const { return this->size_; }
+  uint8_t count() const { return this->count_; }
+
+  void reset() {
+    this->count_ = 0;
+    this->head_ = 0;
+  }
+  void add(uint16_t ppm) {
+    if (this->size_ == 0)
+      return;
+    this->samples_[this->head_] = ppm;
+    this->head_ = (this->head_ + 1) % this->size_;
+    if (this->count_ < this->size_)
+      this->count_++;
+  }
+
+  // Max - min and mean of the window; false until the window is full
+  bool evaluate(uint16_t *spread, float *mean) const {
+    if (this->size_ == 0 || this->count_ < this->size_)
+      return false;
+    uint16_t lo = this->samples_[0];
+    uint16_t hi = lo;
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < this->count_; i++) {
+      uint16_t value = this->samples_[i];
+      if (value < lo)
+        lo = value;
+      if (value > hi)
+        hi = value;
+      sum += value;
+    }
+    *spread = hi - lo;
+    *mean = (float)sum / this->count_;
+    return true;
+  }
+
+protected:
+  uint16_t samples_[SEN6X_CO2_STABILITY_MAX_SAMPLES]{};
+  uint8_t size_{0}; // 0 = gate disabled
+  uint8_t count_{0};
+  uint8_t head_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
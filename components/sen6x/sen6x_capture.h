@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Raw response capture for offline replay. CRC-checked words of the
+// measured-values, Number Concentration and Device Status reads are kept in
+// a byte ring (oldest records are overwritten) and dumped to the log as
+// SEN6XCAP lines, which tools/sen6x_sim/sen6x_replay.cpp feeds back through
+// Sen6xComponent::replay_response(). Compiled in with USE_SEN6X_CAPTURE.
+
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+static const uint16_t SEN6X_DEFAULT_CAPTURE_BUFFER_SIZE = 2048;
+static const uint8_t SEN6X_CAPTURE_MAX_WORDS = 16;
+// Record: timestamp [ms] (4 bytes), command (2), word count (1), then the
+// words (2 bytes each), all little endian
+static const uint8_t SEN6X_CAPTURE_HEADER_SIZE = 7;
+
+class Sen6xCaptureRing {
+public:
+  void allocate(uint16_t size) {
+    if (this->buffer_ != nullptr || size < SEN6X_CAPTURE_HEADER_SIZE)
+      return;
+    this->buffer_ = new uint8_t[size]; // NOLINT
+    this->size_ = size;
+  }
+  bool is_allocated() const { return this->buffer_ != nullptr; }
+
+  void record(uint32_t timestamp_ms, uint16_t command, const uint16_t *words,
+              uint8_t count) {
+    if (this->buffer_ == nullptr || count > SEN6X_CAPTURE_MAX_WORDS)
+      return;
+    uint16_t length = SEN6X_CAPTURE_HEADER_SIZE + count * 2;
+    if (length > this->size_)
+      return;
+    // Drop the oldest records until the new one fits
+    while (this->size_ - this->used_ < length) {
+      uint16_t oldest = SEN6X_CAPTURE_HEADER_SIZE +
+                        this->byte_(this->tail_ + 6) * 2;
+      this->tail_ = (this->tail_ + oldest) % this->size_;
+      this->used_ -= oldest;
+      this->count_--;
+      this->dropped_++;
+    }
+    this->put_(timestamp_ms & 0xFF);
+    this->put_((timestamp_ms >> 8) & 0xFF);
+    this->put_((timestamp_ms >> 16) & 0xFF);
+    this->put_(timestamp_ms >> 24);
+    this->put_(command & 0xFF);
+    this->put_(command >> 8);
+    this->put_(count);
+    for (uint8_t i = 0; i < count; i++) {
+      this->put_(words[i] & 0xFF);
+      this->put_(words[i] >> 8);
+    }
+    this->count_++;
+  }
+
+  // Calls visit(timestamp_ms, command, words, count), oldest record first
+  template<typename F> void for_each(F &&visit) const {
+    uint16_t offset = this->tail_;
+    uint16_t words[SEN6X_CAPTURE_MAX_WORDS];
+    for (uint16_t r = 0; r < this->count_; r++) {
+      uint32_t timestamp = (uint32_t)this->byte_(offset) |
+                           ((uint32_t)this->byte_(offset + 1) << 8) |
+                           ((uint32_t)this->byte_(offset + 2) << 16) |
+                           ((uint32_t)this->byte_(offset + 3) << 24);
+      uint16_t command =
+          this->byte_(offset + 4) | (this->byte_(offset + 5) << 8);
+      uint8_t count = this->byte_(offset + 6);
+      for (uint8_t i = 0; i < count; i++) {
+        uint16_t at = offset + SEN6X_CAPTURE_HEADER_SIZE + i * 2;
+        words[i] = this->byte_(at) | (this->byte_(at + 1) << 8);
+      }
+      visit(timestamp, command, words, count);
+      offset = (offset + SEN6X_CAPTURE_HEADER_SIZE + count * 2) % this->size_;
+    }
+  }
+
+  void clear() {
+    this->head_ = this->tail_ = this->used_ = 0;
+    this->count_ = 0;
+  }
+  uint16_t get_size() const { return this->size_; }
+  uint16_t get_record_count() const { return this->count_; }
+  uint32_t get_dropped_count() const { return this->dropped_; }
+
+protected:
+  uint8_t byte_(uint32_t offset) const {
+    return this->buffer_[offset % this->size_];
+  }
+  void put_(uint8_t value) {
+    this->buffer_[this->head_] = value;
+    this->head_ = (this->head_ + 1) % this->size_;
+    this->used_++;
+  }
+
+  uint8_t *buffer_{nullptr};
+  uint16_t size_{0};
+  uint16_t head_{0};
+  uint16_t tail_{0};
+  uint16_t used_{0};
+  uint16_t count_{0};
+  uint32_t dropped_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
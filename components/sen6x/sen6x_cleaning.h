@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Runtime-based auto fan cleaning. The interval counts fan runtime
+// (measurement mode), not time since boot, and the count survives reboots
+// and OTA updates in a small preference record. A due cleaning can be
+// deferred to a quiet period: a configured time of day (with a time
+// source) and/or a stretch of steady PM2.5, bounded by max_delay.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+// Datasheet: cleaning takes 10 s; measurement is restarted after 12 s
+static const uint32_t SEN6X_FAN_CLEANING_TIME_MS = 12000;
+// Readings are skipped this long after a cleaning (airflow settling)
+static const uint32_t SEN6X_FAN_CLEANING_SETTLE_MS = 10000;
+// Runtime accounting tick; due cleanings are checked on the same tick
+static const uint32_t SEN6X_FAN_RUNTIME_TICK_MS = 60000;
+// Runtime is written at this interval (if changed), on shutdown and after
+// every cleaning, so a crash loses at most this much runtime
+static const uint32_t SEN6X_FAN_RUNTIME_CHECKPOINT_MS = 3600000;
+static const uint32_t SEN6X_CLEANING_PREFERENCE_OFFSET = 10;
+static const uint8_t SEN6X_CLEANING_VERSION = 1;
+
+struct Sen6xCleaningRecord {
+  uint8_t version;
+  uint8_t reserved[3];
+  uint32_t runtime_s;       // Fan runtime since the last cleaning
+  uint32_t total_runtime_s; // Fan runtime since the record was created
+  uint32_t cleanings;
+};
+
+// PM2.5 steadiness for the quiet-period policy: exponentially weighted mean
+// and variance over roughly the last 1 / alpha samples
+static const float SEN6X_QUIET_ALPHA = 0.1f;
+static const uint8_t SEN6X_QUIET_MIN_SAMPLES = 10;
+
+class Sen6xQuietDetector {
+public:
+  void reset() {
+    this->count_ = 0;
+    this->mean_ = 0.0f;
+    this->variance_ = 0.0f;
+  }
+  void feed(float value) {
+    if (std::isnan(value))
+      return;
+    if (this->count_ == 0) {
+      this->mean_ = value;
+      this->variance_ = 0.0f;
+    } else {
+      float delta = value - this->mean_;
+      this->mean_ += SEN6X_QUIET_ALPHA * delta;
+      this->variance_ = (1.0f - SEN6X_QUIET_ALPHA) *
+                        (this->variance_ + SEN6X_QUIET_ALPHA * delta * delta);
+    }
+    if (this->count_ < 255)
+      this->count_++;
+  }
+  // NAN until enough samples were seen
+  float stddev() const {
+    if (this->count_ < SEN6X_QUIET_MIN_SAMPLES)
+      return NAN;
+    return std::sqrt(this->variance_);
+  }
+
+protected:
+  float mean_{0.0f};
+  float variance_{0.0f};
+  uint8_t count_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
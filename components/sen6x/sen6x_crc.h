@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Sensirion CRC-8 (poly 0x31, init 0xFF) with compile-time lookup tables and
+// a single-pass frame verifier
+
+#pragma once
+
+#include "esphome/core/defines.h"
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+static constexpr uint8_t SEN6X_CRC8_POLYNOMIAL = 0x31;
+static constexpr uint8_t SEN6X_CRC8_INIT = 0xFF;
+
+// Bit-by-bit reference implementation, used to generate the tables below
+constexpr uint8_t sen6x_crc_bitwise_step(uint8_t crc, uint8_t bits) {
+  for (uint8_t j = 0; j < bits; j++) {
+    if ((crc & 0x80) != 0)
+      crc = (uint8_t)((crc << 1) ^ SEN6X_CRC8_POLYNOMIAL);
+    else
+      crc = (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+#ifdef SEN6X_CRC_NIBBLE_TABLE
+// 16-byte table (crc_table: NIBBLE) - two lookups per byte, for targets
+// where every byte of flash/RAM counts (ESP8266 keeps const data in RAM)
+struct Sen6xCrcTable {
+  uint8_t entries[16];
+  constexpr Sen6xCrcTable() : entries() {
+    for (uint16_t i = 0; i < 16; i++)
+      entries[i] = sen6x_crc_bitwise_step((uint8_t)(i << 4), 4);
+  }
+};
+
+static constexpr Sen6xCrcTable SEN6X_CRC_TABLE{};
+
+inline uint8_t sen6x_crc_update(uint8_t crc, uint8_t byte) {
+  crc ^= byte;
+  crc = (uint8_t)(crc << 4) ^ SEN6X_CRC_TABLE.entries[crc >> 4];
+  crc = (uint8_t)(crc << 4) ^ SEN6X_CRC_TABLE.entries[crc >> 4];
+  return crc;
+}
+#else
+// 256-byte table (crc_table: FULL, default) - one lookup per byte
+struct Sen6xCrcTable {
+  uint8_t entries[256];
+  constexpr Sen6xCrcTable() : entries() {
+    for (uint16_t i = 0; i < 256; i++)
+      entries[i] = sen6x_crc_bitwise_step((uint8_t)i, 8);
+  }
+};
+
+static constexpr Sen6xCrcTable SEN6X_CRC_TABLE{};
+
+inline uint8_t sen6x_crc_update(uint8_t crc, uint8_t byte) {
+  return SEN6X_CRC_TABLE.entries[crc ^ byte];
+}
+#endif
+
+// Datasheet example: CRC(0xBEEF) = 0x92
+static_assert(sen6x_crc_bitwise_step(
+                  (uint8_t)(sen6x_crc_bitwise_step(SEN6X_CRC8_INIT ^ 0xBE, 8) ^
+                            0xEF),
+                  8) == 0x92,
+              "Sensirion CRC-8 reference mismatch");
+
+inline uint8_t sen6x_crc(const uint8_t *data, uint8_t len) {
+  uint8_t crc = SEN6X_CRC8_INIT;
+  for (uint8_t i = 0; i < len; i++)
+    crc = sen6x_crc_update(crc, data[i]);
+  return crc;
+}
+
+// CRC of a single data word (the wire format checksums every 2 bytes)
+inline uint8_t sen6x_crc_word(uint8_t msb, uint8_t lsb) {
+  return sen6x_crc_update(sen6x_crc_update(SEN6X_CRC8_INIT, msb), lsb);
+}
+
+// Verifies and unpacks a whole wire frame ([MSB, LSB, CRC] per word) into
+// 'words' big-endian words in one pass. Returns the index of the first word
+// with a bad CRC, or -1 if the whole frame is valid. 'out' is only complete
+// on success.
+inline int sen6x_unpack_frame(const uint8_t *frame, uint8_t words,
+                              uint16_t *out) {
+  for (uint8_t i = 0; i < words; i++, frame += 3) {
+    if (sen6x_crc_word(frame[0], frame[1]) != frame[2])
+      return i;
+    out[i] = (uint16_t)((frame[0] << 8) | frame[1]);
+  }
+  return -1;
+}
+
+// Packs 'words' words into wire format (appending a CRC to every word)
+inline void sen6x_pack_frame(const uint16_t *words, uint8_t count,
+                             uint8_t *frame) {
+  for (uint8_t i = 0; i < count; i++, frame += 3) {
+    frame[0] = (uint8_t)(words[i] >> 8);
+    frame[1] = (uint8_t)(words[i] & 0xFF);
+    frame[2] = sen6x_crc_word(frame[0], frame[1]);
+  }
+}
+
+} // namespace sen6x
+} // namespace esphome
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// I2C and update() instrumentation published as diagnostic sensors. Compiled
+// in only when a diagnostic sensor is configured (USE_SEN6X_DIAGNOSTICS);
+// otherwise every recording call is an inline no-op.
+
+#pragma once
+
+#include "esphome/components/i2c/i2c.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+// Why a measurement cycle did not produce a frame
+enum class Sen6xSkipReason : uint8_t {
+  FAN_CLEANING = 0,
+  SETTLING,       // 10s after fan cleaning
+  IDLE_WINDOW,    // Idle-only configuration in progress
+  CYCLE_BUSY,     // Previous cycle still in flight
+  DATA_NOT_READY, // Data-ready flag not set
+  INVALID_FRAME,  // Short frame or at least one unstabilized channel
+  COUNT,
+};
+
+// Diagnostic sensors (sensor.py). Counters are totals since boot, bus and
+// update() times cover the last diagnostics interval.
+enum class Sen6xDiagnosticSensor : uint8_t {
+  I2C_TRANSACTIONS = 0,
+  I2C_NACKS,
+  I2C_CRC_ERRORS,
+  I2C_BUS_TIME,    // [ms] per interval
+  UPDATE_TIME_MIN, // [µs]
+  UPDATE_TIME_AVG,
+  UPDATE_TIME_MAX,
+  SKIPPED_FAN_CLEANING, // Same order as Sen6xSkipReason
+  SKIPPED_SETTLING,
+  SKIPPED_IDLE_WINDOW,
+  SKIPPED_CYCLE_BUSY,
+  SKIPPED_DATA_NOT_READY,
+  INVALID_FRAMES,
+  COUNT,
+};
+
+// I2C activity for one command counted off the main loop (sensor task).
+// It travels with the task's sample and is recorded when the main loop
+// drains it, so the counters are only ever touched by one thread.
+struct Sen6xBusStats {
+  uint8_t transactions;
+  uint8_t nacks;
+  uint8_t crc_errors;
+  uint32_t bus_time_us;
+};
+
+static const uint8_t SEN6X_DIAGNOSTICS_MAX_COMMANDS =
+    24; // Distinct commands tracked individually (the rest are pooled)
+static const uint32_t SEN6X_DEFAULT_DIAGNOSTICS_INTERVAL_MS = 60000;
+
+#ifdef USE_SEN6X_DIAGNOSTICS
+// Per-command counters (logged at VERBOSE level on every publish)
+struct Sen6xCommandStats {
+  uint16_t command;
+  uint32_t transactions;
+  uint32_t nacks;
+  uint32_t crc_errors;
+};
+
+class Sen6xDiagnostics {
+public:
+  void set_sensor(Sen6xDiagnosticSensor id, sensor::Sensor *sens) {
+    sensors_[static_cast<uint8_t>(id)] = sens;
+  }
+
+  // One I2C transfer on behalf of 'command'; a write starts a transaction
+  void record_transfer(uint16_t command, bool is_write, i2c::ErrorCode result,
+                       uint32_t duration_us);
+  void record_crc_error(uint16_t command);
+  void record_bus_stats(uint16_t command, const Sen6xBusStats &stats);
+  void record_skip(Sen6xSkipReason reason) {
+    skips_[static_cast<uint8_t>(reason)]++;
+  }
+  void record_update_time(uint32_t duration_us);
+
+  // Publishes all configured sensors and starts the next interval
+  void publish();
+
+protected:
+  Sen6xCommandStats *command_stats_(uint16_t command);
+  void publish_(Sen6xDiagnosticSensor id, float value);
+
+  sensor::Sensor
+      *sensors_[static_cast<uint8_t>(Sen6xDiagnosticSensor::COUNT)]{};
+  Sen6xCommandStats commands_[SEN6X_DIAGNOSTICS_MAX_COMMANDS]{};
+  uint8_t command_count_{0};
+  uint32_t transactions_{0};
+  uint32_t nacks_{0};
+  uint32_t crc_errors_{0};
+  uint32_t skips_[static_cast<uint8_t>(Sen6xSkipReason::COUNT)]{};
+
+  // Current interval
+  uint32_t bus_time_us_{0};
+  uint32_t update_count_{0};
+  uint32_t update_min_us_{0};
+  uint32_t update_max_us_{0};
+  uint64_t update_sum_us_{0};
+};
+
+// Records the wall time of the enclosing scope as one update() run
+class Sen6xUpdateTimer {
+public:
+  explicit Sen6xUpdateTimer(Sen6xDiagnostics &diagnostics)
+      : diagnostics_(diagnostics), start_us_(micros()) {}
+  ~Sen6xUpdateTimer() {
+    diagnostics_.record_update_time(micros() - start_us_);
+  }
+
+protected:
+  Sen6xDiagnostics &diagnostics_;
+  uint32_t start_us_;
+};
+#else
+class Sen6xDiagnostics {
+public:
+  void set_sensor(Sen6xDiagnosticSensor id, sensor::Sensor *sens) {}
+  void record_crc_error(uint16_t command) {}
+  void record_bus_stats(uint16_t command, const Sen6xBusStats &stats) {}
+  void record_skip(Sen6xSkipReason reason) {}
+  void publish() {}
+};
+
+class Sen6xUpdateTimer {
+public:
+  explicit Sen6xUpdateTimer(Sen6xDiagnostics &diagnostics) {}
+};
+#endif
+
+} // namespace sen6x
+} // namespace esphome
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Smoothing for the external pressure feed (pressure_source). Barometers
+// report every few seconds with noise on the order of 0.1 hPa; the filtered
+// value is what the rate limiter and hysteresis in sen6x.cpp compare
+// against the last value written to the sensor.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+enum class Sen6xPressureFilterMode : uint8_t {
+  NONE = 0, // Latest reading
+  EMA,      // Exponential moving average
+  MEDIAN,   // Median of the newest 'window' readings (rejects spikes)
+};
+
+static const uint8_t SEN6X_PRESSURE_MAX_WINDOW = 9;
+static const float SEN6X_DEFAULT_PRESSURE_ALPHA = 0.2f;
+static const uint8_t SEN6X_DEFAULT_PRESSURE_WINDOW = 5;
+static const uint32_t SEN6X_DEFAULT_PRESSURE_MIN_INTERVAL_MS = 60000;
+static const float SEN6X_DEFAULT_PRESSURE_HYSTERESIS = 1.0f; // [hPa]
+
+class Sen6xPressureFilter {
+public:
+  void configure(Sen6xPressureFilterMode mode, float alpha, uint8_t window) {
+    this->mode_ = mode;
+    this->alpha_ = alpha;
+    if (window == 0)
+      window = 1;
+    if (window > SEN6X_PRESSURE_MAX_WINDOW)
+      window = SEN6X_PRESSURE_MAX_WINDOW;
+    this->window_ = window;
+    this->reset();
+  }
+  void reset() {
+    this->ema_ = NAN;
+    this->count_ = 0;
+    this->head_ = 0;
+  }
+
+  // Adds a reading and returns the filtered value
+  float feed(float value) {
+    switch (this->mode_) {
+    case Sen6xPressureFilterMode::EMA:
+      this->ema_ = std::isnan(this->ema_)
+                       ? value
+                       : this->ema_ + this->alpha_ * (value - this->ema_);
+      return this->ema_;
+    case Sen6xPressureFilterMode::MEDIAN:
+      this->samples_[this->head_] = value;
+      this->head_ = (this->head_ + 1) % this->window_;
+      if (this->count_ < this->window_)
+        this->count_++;
+      return this->median_();
+    case Sen6xPressureFilterMode::NONE:
+    default:
+      return value;
+    }
+  }
+
+protected:
+  float median_() const {
+    // Insertion sort of at most SEN6X_PRESSURE_MAX_WINDOW values
+    float sorted[SEN6X_PRESSURE_MAX_WINDOW];
+    for (uint8_t i = 0; i < this->count_; i++) {
+      float value = this->samples_[i];
+      uint8_t j = i;
+      for (; j > 0 && sorted[j - 1] > value; j--)
+        sorted[j] = sorted[j - 1];
+      sorted[j] = value;
+    }
+    if (this->count_ % 2 == 1)
+      return sorted[this->count_ / 2];
+    return (sorted[this->count_ / 2 - 1] + sorted[this->count_ / 2]) / 2.0f;
+  }
+
+  Sen6xPressureFilterMode mode_{Sen6xPressureFilterMode::EMA};
+  float alpha_{SEN6X_DEFAULT_PRESSURE_ALPHA};
+  uint8_t window_{SEN6X_DEFAULT_PRESSURE_WINDOW};
+  float ema_{NAN};
+  float samples_[SEN6X_PRESSURE_MAX_WINDOW]{};
+  uint8_t count_{0};
+  uint8_t head_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
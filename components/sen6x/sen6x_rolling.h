@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Sliding-window means for building-standard compliance windows (8 h / 24 h
+// averages, see AQI_BuildingStandards AppNote). The window is split into
+// fixed-length buckets holding a running mean and a sample count, so memory
+// is bounded by the bucket count and a sample costs O(1); the closed buckets
+// are re-summed only when a bucket rotates. The window advances by one
+// bucket at a time, i.e. it covers between (buckets - 1) and buckets bucket
+// lengths. Compiled in only when an *_average sensor is configured
+// (USE_SEN6X_ROLLING_AVERAGE).
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+static const uint8_t SEN6X_ROLLING_MAX_BUCKETS = 24;
+static const uint8_t SEN6X_ROLLING_CHECKPOINT_VERSION = 1;
+// Checkpoints are written at this interval and on shutdown
+static const uint32_t SEN6X_ROLLING_CHECKPOINT_INTERVAL_MS = 3600000;
+
+// Running mean of one bucket (a mean instead of a sum keeps float precision
+// with many samples per bucket)
+struct Sen6xRollingBucket {
+  float mean;
+  uint32_t count;
+};
+
+// Preference record of one window (fixed size for make_preference)
+struct Sen6xRollingCheckpoint {
+  uint8_t version;
+  uint8_t buckets;
+  uint8_t head;
+  uint8_t reserved;
+  uint32_t window_ms;
+  uint32_t head_elapsed_ms; // Time already spent in the head bucket
+  Sen6xRollingBucket data[SEN6X_ROLLING_MAX_BUCKETS];
+};
+
+class Sen6xRollingMean {
+public:
+  void configure(uint32_t window_ms, uint8_t buckets) {
+    if (buckets < 2)
+      buckets = 2;
+    if (buckets > SEN6X_ROLLING_MAX_BUCKETS)
+      buckets = SEN6X_ROLLING_MAX_BUCKETS;
+    this->window_ms_ = window_ms;
+    this->bucket_count_ = buckets;
+    this->bucket_ms_ = window_ms / buckets;
+    if (this->bucket_ms_ == 0)
+      this->bucket_ms_ = 1;
+  }
+  uint32_t window_ms() const { return this->window_ms_; }
+  uint8_t bucket_count() const { return this->bucket_count_; }
+
+  void start(uint32_t now) {
+    for (uint8_t i = 0; i < this->bucket_count_; i++)
+      this->buckets_[i] = {0.0f, 0};
+    this->head_ = 0;
+    this->head_start_ms_ = now;
+    this->resum_closed_();
+  }
+
+  // Adds a sample; true when a bucket was closed on the way
+  bool add(float value, uint32_t now) {
+    bool rotated = this->advance(now);
+    Sen6xRollingBucket &bucket = this->buckets_[this->head_];
+    bucket.count++;
+    bucket.mean += (value - bucket.mean) / (float)bucket.count;
+    return rotated;
+  }
+
+  // Rotates out buckets older than the window; true when one was closed
+  bool advance(uint32_t now) {
+    uint32_t elapsed = now - this->head_start_ms_;
+    if (elapsed < this->bucket_ms_)
+      return false;
+    uint32_t steps = elapsed / this->bucket_ms_;
+    if (steps >= this->bucket_count_) {
+      // Nothing measured for a whole window (duty sleep, stopped sensor)
+      this->start(now - elapsed % this->bucket_ms_);
+      return true;
+    }
+    for (uint32_t i = 0; i < steps; i++) {
+      this->head_ = (this->head_ + 1) % this->bucket_count_;
+      this->buckets_[this->head_] = {0.0f, 0};
+    }
+    this->head_start_ms_ += steps * this->bucket_ms_;
+    this->resum_closed_();
+    return true;
+  }
+
+  // Window mean (closed buckets plus the open one), NAN without samples
+  float mean() const {
+    const Sen6xRollingBucket &head = this->buckets_[this->head_];
+    uint32_t count = this->closed_count_ + head.count;
+    if (count == 0)
+      return NAN;
+    return (this->closed_sum_ + head.mean * (float)head.count) / (float)count;
+  }
+
+  void save(Sen6xRollingCheckpoint &checkpoint, uint32_t now) const {
+    checkpoint = {};
+    checkpoint.version = SEN6X_ROLLING_CHECKPOINT_VERSION;
+    checkpoint.buckets = this->bucket_count_;
+    checkpoint.head = this->head_;
+    checkpoint.window_ms = this->window_ms_;
+    checkpoint.head_elapsed_ms = now - this->head_start_ms_;
+    for (uint8_t i = 0; i < this->bucket_count_; i++)
+      checkpoint.data[i] = this->buckets_[i];
+  }
+
+  // Resumes a saved window. Downtime is not known (no wall clock), so the
+  // window continues where it stopped. False when the layout changed.
+  bool restore(const Sen6xRollingCheckpoint &checkpoint, uint32_t now) {
+    if (checkpoint.version != SEN6X_ROLLING_CHECKPOINT_VERSION ||
+        checkpoint.buckets != this->bucket_count_ ||
+        checkpoint.window_ms != this->window_ms_ ||
+        checkpoint.head >= this->bucket_count_)
+      return false;
+    for (uint8_t i = 0; i < this->bucket_count_; i++) {
+      this->buckets_[i] = checkpoint.data[i];
+      if (std::isnan(this->buckets_[i].mean))
+        this->buckets_[i] = {0.0f, 0};
+    }
+    this->head_ = checkpoint.head;
+    uint32_t elapsed = checkpoint.head_elapsed_ms;
+    if (elapsed >= this->bucket_ms_)
+      elapsed = this->bucket_ms_ - 1;
+    this->head_start_ms_ = now - elapsed;
+    this->resum_closed_();
+    return true;
+  }
+
+protected:
+  void resum_closed_() {
+    float sum = 0.0f;
+    uint32_t count = 0;
+    for (uint8_t i = 0; i < this->bucket_count_; i++) {
+      if (i == this->head_)
+        continue;
+      sum += this->buckets_[i].mean * (float)this->buckets_[i].count;
+      count += this->buckets_[i].count;
+    }
+    this->closed_sum_ = sum;
+    this->closed_count_ = count;
+  }
+
+  Sen6xRollingBucket buckets_[SEN6X_ROLLING_MAX_BUCKETS]{};
+  uint32_t window_ms_{0};
+  uint32_t bucket_ms_{1};
+  uint32_t head_start_ms_{0};
+  float closed_sum_{0.0f};
+  uint32_t closed_count_{0};
+  uint8_t bucket_count_{2};
+  uint8_t head_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Lock-free single-producer/single-consumer ring between the optional sensor
+// task (producer, USE_SEN6X_SENSOR_TASK) and the main loop (consumer). The
+// indices are the only shared state: the producer owns head_, the consumer
+// owns tail_, and release/acquire ordering publishes the slot contents.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+// Holds N - 1 items (one slot stays empty to tell full from empty)
+template<typename T, uint8_t N> class Sen6xSpscRing {
+public:
+  // Producer only; false when full
+  bool push(const T &item) {
+    uint8_t head = this->head_.load(std::memory_order_relaxed);
+    uint8_t next = (head + 1) % N;
+    if (next == this->tail_.load(std::memory_order_acquire))
+      return false;
+    this->items_[head] = item;
+    this->head_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only; false when empty
+  bool pop(T &item) {
+    uint8_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return false;
+    item = this->items_[tail];
+    this->tail_.store((tail + 1) % N, std::memory_order_release);
+    return true;
+  }
+
+protected:
+  T items_[N]{};
+  std::atomic<uint8_t> head_{0};
+  std::atomic<uint8_t> tail_{0};
+};
+
+} // namespace sen6x
+} // namespace esphome
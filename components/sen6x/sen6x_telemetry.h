@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// SEN6x ESPHome Component - Official Version
+// Packed telemetry: one measurement cycle serialized into a fixed-layout
+// binary frame and published base64-encoded as a single text sensor state,
+// instead of one entity update per channel. Compiled in only when the
+// telemetry_frame text sensor is configured (USE_SEN6X_TELEMETRY).
+//
+// Frame layout (version 1, little endian, 44 bytes):
+//   0  u8   version
+//   1  u8   model (Sen6xModel)
+//   2  u16  sequence (increments per frame, wraps)
+//   4  u32  timestamp [ms since boot]
+//   8  u32  device status register (0 until first read)
+//   12 u16  valid mask (bit n = slot n holds a stabilized value)
+//   14 u16  slots[SEN6X_TELEMETRY_SLOTS], raw words as read from the sensor
+// Slots keep the sensor's scaling (see SEN6X_CHANNEL_SCALES). Slots the
+// model does not measure, or that were not read this cycle, are cleared in
+// the mask.
+
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_SEN6X_TELEMETRY
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+#include <cstdint>
+
+namespace esphome {
+namespace sen6x {
+
+// Slot order of the frame (TVOC estimates are derived, not carried)
+enum class Sen6xTelemetrySlot : uint8_t {
+  PM_1_0 = 0,
+  PM_2_5,
+  PM_4_0,
+  PM_10_0,
+  HUMIDITY,
+  TEMPERATURE,
+  VOC_INDEX,
+  NOX_INDEX,
+  CO2,
+  FORMALDEHYDE,
+  NC_0_5,
+  NC_1_0,
+  NC_2_5,
+  NC_4_0,
+  NC_10_0,
+  COUNT,
+};
+
+static const uint8_t SEN6X_TELEMETRY_VERSION = 1;
+static const uint8_t SEN6X_TELEMETRY_SLOTS =
+    static_cast<uint8_t>(Sen6xTelemetrySlot::COUNT);
+static const uint8_t SEN6X_TELEMETRY_HEADER_SIZE = 14;
+static const uint8_t SEN6X_TELEMETRY_FRAME_SIZE =
+    SEN6X_TELEMETRY_HEADER_SIZE + SEN6X_TELEMETRY_SLOTS * 2;
+
+#ifdef USE_SEN6X_TELEMETRY
+class Sen6xTelemetry {
+public:
+  void set_text_sensor(text_sensor::TextSensor *sens) { sensor_ = sens; }
+  bool is_enabled() const { return sensor_ != nullptr; }
+
+  // Starts a cycle: all slots invalid until set
+  void begin() {
+    this->valid_mask_ = 0;
+    this->pending_ = true;
+  }
+  void set_word(Sen6xTelemetrySlot slot, uint16_t raw) {
+    uint8_t index = static_cast<uint8_t>(slot);
+    this->slots_[index] = raw;
+    this->valid_mask_ |= 1U << index;
+  }
+
+  // Serializes the cycle started by begin() into 'frame'
+  void encode(uint8_t model, uint32_t timestamp_ms, uint32_t device_status,
+              uint8_t *frame) const;
+  // Publishes the pending cycle (no-op when begin() was not called)
+  void publish(uint8_t model, uint32_t timestamp_ms, uint32_t device_status);
+
+protected:
+  text_sensor::TextSensor *sensor_{nullptr};
+  uint16_t slots_[SEN6X_TELEMETRY_SLOTS]{};
+  uint16_t valid_mask_{0};
+  uint16_t sequence_{0};
+  bool pending_{false};
+};
+#else
+class Sen6xTelemetry {
+public:
+  bool is_enabled() const { return false; }
+  void begin() {}
+  void set_word(Sen6xTelemetrySlot slot, uint16_t raw) {}
+  void publish(uint8_t model, uint32_t timestamp_ms, uint32_t device_status) {
+  }
+};
+#endif
+
+} // namespace sen6x
+} // namespace esphome
@@ -21,13 +21,20 @@ from esphome.const import (
     DEVICE_CLASS_PM10,
     DEVICE_CLASS_TEMPERATURE,
     STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_CELSIUS,
     UNIT_MICROGRAMS_PER_CUBIC_METER,
     UNIT_PARTS_PER_MILLION,
     UNIT_PERCENT,
 )
 
-from . import Sen6xComponent, CONF_SEN6X_ID
+from . import (
+    Sen6xComponent,
+    Sen6xAggregate,
+    Sen6xChannel,
+    Sen6xDiagnosticSensor,
+    CONF_SEN6X_ID,
+)
 
 CONF_PM_4_0 = "pm_4_0"
 CONF_VOC_INDEX = "voc_index"
@@ -43,6 +50,233 @@ CONF_NC_4_0 = "nc_4_0"
 CONF_NC_10_0 = "nc_10_0"
 CONF_AMBIENT_PRESSURE = "ambient_pressure"
 CONF_SENSOR_ALTITUDE = "sensor_altitude"
+CONF_FLASH_WRITES = "flash_writes"
+CONF_DUTY_RATIO = "duty_ratio"
+CONF_HEATER_HUMIDITY = "heater_humidity"
+CONF_CO2_CORRECTION = "co2_correction"
+CONF_HEATER_TEMPERATURE = "heater_temperature"
+
+# Change-only publishing (filtered inside the component, before publish_state)
+CONF_DEADBAND = "deadband"
+CONF_HEARTBEAT = "heartbeat"
+
+PUBLISH_FILTER_SCHEMA = cv.Schema({
+    # Publish only when the value moves by more than this (sensor units)
+    cv.Optional(CONF_DEADBAND): cv.positive_float,
+    # Republish an unchanged value at least this often
+    cv.Optional(CONF_HEARTBEAT): cv.positive_time_period_milliseconds,
+})
+
+# Statistic published per window when the hub has aggregation_interval set
+CONF_AGGREGATE = "aggregate"
+AGGREGATES = {
+    "MEAN": Sen6xAggregate.MEAN,
+    "MIN": Sen6xAggregate.MIN,
+    "MAX": Sen6xAggregate.MAX,
+    "STDDEV": Sen6xAggregate.STDDEV,
+    "LAST": Sen6xAggregate.LAST,
+}
+
+# Raw (buffered) channels accept an aggregate; TVOC estimates are the
+# window mean of the per-sample estimates
+AGGREGATE_SCHEMA = PUBLISH_FILTER_SCHEMA.extend({
+    cv.Optional(CONF_AGGREGATE, default="MEAN"): cv.enum(AGGREGATES, upper=True),
+})
+
+# Measurement channels that support deadband/heartbeat
+MEASUREMENT_CHANNELS = {
+    CONF_PM_1_0: Sen6xChannel.PM_1_0,
+    CONF_PM_2_5: Sen6xChannel.PM_2_5,
+    CONF_PM_4_0: Sen6xChannel.PM_4_0,
+    CONF_PM_10_0: Sen6xChannel.PM_10_0,
+    CONF_HUMIDITY: Sen6xChannel.HUMIDITY,
+    CONF_TEMPERATURE: Sen6xChannel.TEMPERATURE,
+    CONF_VOC_INDEX: Sen6xChannel.VOC_INDEX,
+    CONF_NOX_INDEX: Sen6xChannel.NOX_INDEX,
+    CONF_CO2: Sen6xChannel.CO2,
+    CONF_FORMALDEHYDE: Sen6xChannel.FORMALDEHYDE,
+    CONF_TVOC_WELL: Sen6xChannel.TVOC_WELL,
+    CONF_TVOC_RESET: Sen6xChannel.TVOC_RESET,
+    CONF_TVOC_ETHANOL: Sen6xChannel.TVOC_ETHANOL,
+    CONF_NC_0_5: Sen6xChannel.NC_0_5,
+    CONF_NC_1_0: Sen6xChannel.NC_1_0,
+    CONF_NC_2_5: Sen6xChannel.NC_2_5,
+    CONF_NC_4_0: Sen6xChannel.NC_4_0,
+    CONF_NC_10_0: Sen6xChannel.NC_10_0,
+}
+
+# Channels whose C++ support is compiled in only when configured
+TVOC_CHANNELS = (CONF_TVOC_WELL, CONF_TVOC_RESET, CONF_TVOC_ETHANOL)
+NUMBER_CONCENTRATION_CHANNELS = (
+    CONF_NC_0_5,
+    CONF_NC_1_0,
+    CONF_NC_2_5,
+    CONF_NC_4_0,
+    CONF_NC_10_0,
+)
+
+# Rolling window averages (building-standard limits are judged on 8 h / 24 h
+# means). Each needs its source channel configured; the window is kept in
+# 'buckets' fixed-length buckets and checkpointed to flash.
+CONF_WINDOW = "window"
+CONF_BUCKETS = "buckets"
+MAX_ROLLING_BUCKETS = 24  # SEN6X_ROLLING_MAX_BUCKETS
+
+
+def _rolling_average_schema(unit, icon, accuracy, device_class=None):
+    schema = sensor.sensor_schema(
+        unit_of_measurement=unit,
+        icon=icon,
+        accuracy_decimals=accuracy,
+        device_class=device_class,
+        state_class=STATE_CLASS_MEASUREMENT,
+    )
+    return schema.extend({
+        cv.Optional(CONF_WINDOW, default="24h"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(minutes=10), max=cv.TimePeriod(days=7)),
+        ),
+        cv.Optional(CONF_BUCKETS, default=24): cv.int_range(
+            min=2, max=MAX_ROLLING_BUCKETS
+        ),
+    })
+
+
+# average key -> (channel, source sensor key, schema)
+ROLLING_AVERAGES = {
+    "pm_2_5_average": (
+        Sen6xChannel.PM_2_5,
+        CONF_PM_2_5,
+        _rolling_average_schema(
+            UNIT_MICROGRAMS_PER_CUBIC_METER, "mdi:blur", 1, DEVICE_CLASS_PM25
+        ),
+    ),
+    "pm_10_0_average": (
+        Sen6xChannel.PM_10_0,
+        CONF_PM_10_0,
+        _rolling_average_schema(
+            UNIT_MICROGRAMS_PER_CUBIC_METER, "mdi:blur", 1, DEVICE_CLASS_PM10
+        ),
+    ),
+    "co2_average": (
+        Sen6xChannel.CO2,
+        CONF_CO2,
+        _rolling_average_schema(
+            UNIT_PARTS_PER_MILLION,
+            "mdi:molecule-co2",
+            0,
+            DEVICE_CLASS_CARBON_DIOXIDE,
+        ),
+    ),
+    "formaldehyde_average": (
+        Sen6xChannel.FORMALDEHYDE,
+        CONF_FORMALDEHYDE,
+        _rolling_average_schema("ppb", "mdi:molecule", 1),
+    ),
+    "tvoc_well_average": (
+        Sen6xChannel.TVOC_WELL,
+        CONF_TVOC_WELL,
+        _rolling_average_schema(
+            "µg/m³", "mdi:air-filter", 0, "volatile_organic_compounds"
+        ),
+    ),
+    "tvoc_reset_average": (
+        Sen6xChannel.TVOC_RESET,
+        CONF_TVOC_RESET,
+        _rolling_average_schema(
+            "µg/m³", "mdi:air-filter", 0, "volatile_organic_compounds"
+        ),
+    ),
+}
+
+
+def validate_rolling_averages(config):
+    for key, (_, source, _) in ROLLING_AVERAGES.items():
+        if key not in config:
+            continue
+        if source not in config:
+            raise cv.Invalid(f"'{key}' requires the '{source}' sensor")
+        window_ms = config[key][CONF_WINDOW].total_milliseconds
+        if window_ms // config[key][CONF_BUCKETS] < 60000:
+            raise cv.Invalid(
+                f"'{key}': buckets must be at least 1 min long "
+                f"(window / buckets)"
+            )
+    return config
+
+
+# I2C / update() instrumentation (diagnostic, compiled in only when used).
+# Counters are totals since boot; times cover one diagnostics_interval.
+def _counter_schema(icon):
+    return sensor.sensor_schema(
+        icon=icon,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category="diagnostic",
+    )
+
+
+def _time_schema(unit, icon):
+    return sensor.sensor_schema(
+        unit_of_measurement=unit,
+        icon=icon,
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category="diagnostic",
+    )
+
+
+DIAGNOSTIC_SENSORS = {
+    "i2c_transactions": (
+        Sen6xDiagnosticSensor.I2C_TRANSACTIONS,
+        _counter_schema("mdi:swap-horizontal"),
+    ),
+    "i2c_nacks": (Sen6xDiagnosticSensor.I2C_NACKS, _counter_schema("mdi:alert")),
+    "i2c_crc_errors": (
+        Sen6xDiagnosticSensor.I2C_CRC_ERRORS,
+        _counter_schema("mdi:alert-circle"),
+    ),
+    "i2c_bus_time": (
+        Sen6xDiagnosticSensor.I2C_BUS_TIME,
+        _time_schema("ms", "mdi:timer-outline"),
+    ),
+    "update_time_min": (
+        Sen6xDiagnosticSensor.UPDATE_TIME_MIN,
+        _time_schema("µs", "mdi:timer-outline"),
+    ),
+    "update_time_avg": (
+        Sen6xDiagnosticSensor.UPDATE_TIME_AVG,
+        _time_schema("µs", "mdi:timer-outline"),
+    ),
+    "update_time_max": (
+        Sen6xDiagnosticSensor.UPDATE_TIME_MAX,
+        _time_schema("µs", "mdi:timer-outline"),
+    ),
+    "skipped_fan_cleaning": (
+        Sen6xDiagnosticSensor.SKIPPED_FAN_CLEANING,
+        _counter_schema("mdi:fan-off"),
+    ),
+    "skipped_settling": (
+        Sen6xDiagnosticSensor.SKIPPED_SETTLING,
+        _counter_schema("mdi:timer-sand"),
+    ),
+    "skipped_idle_window": (
+        Sen6xDiagnosticSensor.SKIPPED_IDLE_WINDOW,
+        _counter_schema("mdi:pause-circle"),
+    ),
+    "skipped_cycle_busy": (
+        Sen6xDiagnosticSensor.SKIPPED_CYCLE_BUSY,
+        _counter_schema("mdi:progress-clock"),
+    ),
+    "skipped_data_not_ready": (
+        Sen6xDiagnosticSensor.SKIPPED_DATA_NOT_READY,
+        _counter_schema("mdi:clock-alert"),
+    ),
+    "invalid_frames": (
+        Sen6xDiagnosticSensor.INVALID_FRAMES,
+        _counter_schema("mdi:cancel"),
+    ),
+}
 
 # VOC/NOx Algorithm Tuning parameters (6 parameters per Sensirion datasheet)
 CONF_ALGORITHM_TUNING = "algorithm_tuning"
@@ -83,7 +317,7 @@ ALGORITHM_TUNING_SCHEMA = lambda defaults: cv.Schema({
     cv.Optional(CONF_GAIN_FACTOR, default=defaults["gain_factor"]): cv.int_range(min=1, max=1000),
 })
 
-CONFIG_SCHEMA = cv.Schema(
+CONFIG_SCHEMA = cv.All(cv.Schema(
     {
         cv.GenerateID(CONF_SEN6X_ID): cv.use_id(Sen6xComponent),
         cv.Optional(CONF_PM_1_0): sensor.sensor_schema(
@@ -92,41 +326,41 @@ CONFIG_SCHEMA = cv.Schema(
             accuracy_decimals=1,
             device_class=DEVICE_CLASS_PM1,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_PM_2_5): sensor.sensor_schema(
             unit_of_measurement=UNIT_MICROGRAMS_PER_CUBIC_METER,
             icon="mdi:blur",
             accuracy_decimals=1,
             device_class=DEVICE_CLASS_PM25,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_PM_4_0): sensor.sensor_schema(
             unit_of_measurement=UNIT_MICROGRAMS_PER_CUBIC_METER,
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_PM_10_0): sensor.sensor_schema(
             unit_of_measurement=UNIT_MICROGRAMS_PER_CUBIC_METER,
             icon="mdi:blur",
             accuracy_decimals=1,
             device_class=DEVICE_CLASS_PM10,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_HUMIDITY): sensor.sensor_schema(
             unit_of_measurement=UNIT_PERCENT,
             icon="mdi:water-percent",
             accuracy_decimals=1,
             device_class=DEVICE_CLASS_HUMIDITY,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_TEMPERATURE): sensor.sensor_schema(
             unit_of_measurement=UNIT_CELSIUS,
             icon="mdi:thermometer",
             accuracy_decimals=1,
             device_class=DEVICE_CLASS_TEMPERATURE,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_VOC_INDEX): sensor.sensor_schema(
             icon="mdi:air-filter",
             accuracy_decimals=0,
@@ -134,7 +368,7 @@ CONFIG_SCHEMA = cv.Schema(
         ).extend({
             # Advanced: VOC algorithm tuning (6 parameters per datasheet)
             cv.Optional(CONF_ALGORITHM_TUNING): ALGORITHM_TUNING_SCHEMA(VOC_DEFAULTS),
-        }),
+        }).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_NOX_INDEX): sensor.sensor_schema(
             icon="mdi:air-filter",
             accuracy_decimals=0,
@@ -142,76 +376,76 @@ CONFIG_SCHEMA = cv.Schema(
         ).extend({
             # Advanced: NOx algorithm tuning (6 parameters per datasheet)
             cv.Optional(CONF_ALGORITHM_TUNING): ALGORITHM_TUNING_SCHEMA(NOX_DEFAULTS),
-        }),
+        }).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_CO2): sensor.sensor_schema(
             unit_of_measurement=UNIT_PARTS_PER_MILLION,
             icon="mdi:molecule-co2",
             accuracy_decimals=0,
             device_class=DEVICE_CLASS_CARBON_DIOXIDE,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_FORMALDEHYDE): sensor.sensor_schema(
             unit_of_measurement="ppb",
             icon="mdi:molecule",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_TVOC_WELL): sensor.sensor_schema(
             unit_of_measurement="µg/m³",
             icon="mdi:air-filter",
             accuracy_decimals=0,
             device_class="volatile_organic_compounds",
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(PUBLISH_FILTER_SCHEMA),
         cv.Optional(CONF_TVOC_RESET): sensor.sensor_schema(
             unit_of_measurement="µg/m³",
             icon="mdi:air-filter",
             accuracy_decimals=0,
             device_class="volatile_organic_compounds",
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(PUBLISH_FILTER_SCHEMA),
         cv.Optional(CONF_TVOC_ETHANOL): sensor.sensor_schema(
             unit_of_measurement="ppb",
             icon="mdi:chemical-weapon",
             accuracy_decimals=0,
             device_class="volatile_organic_compounds",
             state_class=STATE_CLASS_MEASUREMENT,
-        ),
+        ).extend(PUBLISH_FILTER_SCHEMA),
         cv.Optional(CONF_NC_0_5): sensor.sensor_schema(
             unit_of_measurement="#/cm³",
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_NC_1_0): sensor.sensor_schema(
             unit_of_measurement="#/cm³",
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_NC_2_5): sensor.sensor_schema(
             unit_of_measurement="#/cm³",
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_NC_4_0): sensor.sensor_schema(
             unit_of_measurement="#/cm³",
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_NC_10_0): sensor.sensor_schema(
             unit_of_measurement="#/cm³",
             icon="mdi:blur",
             accuracy_decimals=1,
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
-        ),
+        ).extend(AGGREGATE_SCHEMA),
         cv.Optional(CONF_AMBIENT_PRESSURE): sensor.sensor_schema(
             unit_of_measurement="hPa",
             icon="mdi:gauge",
@@ -226,13 +460,79 @@ CONFIG_SCHEMA = cv.Schema(
             state_class=STATE_CLASS_MEASUREMENT,
             entity_category="diagnostic",
         ),
+        **{
+            cv.Optional(key): schema
+            for key, (_, schema) in DIAGNOSTIC_SENSORS.items()
+        },
+        # Flash writes since boot (settings, VOC baseline, rolling averages)
+        cv.Optional(CONF_FLASH_WRITES): sensor.sensor_schema(
+            icon="mdi:content-save",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category="diagnostic",
+        ),
+        # Share of the last duty-cycle period spent measuring (duty_cycle:)
+        cv.Optional(CONF_DUTY_RATIO): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon="mdi:sleep",
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category="diagnostic",
+        ),
+        # Correction applied by the last forced CO2 recalibration
+        cv.Optional(CONF_CO2_CORRECTION): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PARTS_PER_MILLION,
+            icon="mdi:tune-vertical",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category="diagnostic",
+        ),
+        # SHT reading at the end of a heater cycle (button or sht_heater:)
+        cv.Optional(CONF_HEATER_HUMIDITY): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon="mdi:water-percent",
+            accuracy_decimals=2,
+            device_class=DEVICE_CLASS_HUMIDITY,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category="diagnostic",
+        ),
+        cv.Optional(CONF_HEATER_TEMPERATURE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_CELSIUS,
+            icon="mdi:heat-wave",
+            accuracy_decimals=2,
+            device_class=DEVICE_CLASS_TEMPERATURE,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category="diagnostic",
+        ),
+        **{
+            cv.Optional(key): schema
+            for key, (_, _, schema) in ROLLING_AVERAGES.items()
+        },
     }
-)
+), validate_rolling_averages)
 
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
 
+    # Optional C++ subsystems (see USE_SEN6X_* in sen6x.h)
+    if any(key in config for key in TVOC_CHANNELS):
+        cg.add_define("USE_SEN6X_TVOC")
+    if any(key in config for key in NUMBER_CONCENTRATION_CHANNELS):
+        cg.add_define("USE_SEN6X_NUMBER_CONCENTRATION")
+    if any(key in config for key in DIAGNOSTIC_SENSORS):
+        cg.add_define("USE_SEN6X_DIAGNOSTICS")
+    if any(key in config for key in ROLLING_AVERAGES):
+        cg.add_define("USE_SEN6X_ROLLING_AVERAGE")
+    if CONF_FLASH_WRITES in config:
+        cg.add_define("USE_SEN6X_FLASH_WRITES")
+    if CONF_DUTY_RATIO in config:
+        cg.add_define("USE_SEN6X_DUTY_RATIO")
+    if CONF_CO2_CORRECTION in config:
+        cg.add_define("USE_SEN6X_CO2_CORRECTION")
+    if CONF_HEATER_HUMIDITY in config or CONF_HEATER_TEMPERATURE in config:
+        cg.add_define("USE_SEN6X_HEATER_SENSORS")
+
     if CONF_PM_1_0 in config:
         sens = await sensor.new_sensor(config[CONF_PM_1_0])
         cg.add(hub.set_pm_1_0_sensor(sens))
@@ -320,3 +620,47 @@ async def to_code(config):
     if CONF_SENSOR_ALTITUDE in config:
         sens = await sensor.new_sensor(config[CONF_SENSOR_ALTITUDE])
         cg.add(hub.set_sensor_altitude_sensor(sens))
+    if CONF_FLASH_WRITES in config:
+        sens = await sensor.new_sensor(config[CONF_FLASH_WRITES])
+        cg.add(hub.set_flash_writes_sensor(sens))
+    if CONF_DUTY_RATIO in config:
+        sens = await sensor.new_sensor(config[CONF_DUTY_RATIO])
+        cg.add(hub.set_duty_ratio_sensor(sens))
+    if CONF_CO2_CORRECTION in config:
+        sens = await sensor.new_sensor(config[CONF_CO2_CORRECTION])
+        cg.add(hub.set_co2_correction_sensor(sens))
+    if CONF_HEATER_HUMIDITY in config:
+        sens = await sensor.new_sensor(config[CONF_HEATER_HUMIDITY])
+        cg.add(hub.set_heater_humidity_sensor(sens))
+    if CONF_HEATER_TEMPERATURE in config:
+        sens = await sensor.new_sensor(config[CONF_HEATER_TEMPERATURE])
+        cg.add(hub.set_heater_temperature_sensor(sens))
+
+    for key, (sensor_id, _) in DIAGNOSTIC_SENSORS.items():
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(hub.set_diagnostic_sensor(sensor_id, sens))
+
+    for key, (channel, _, _) in ROLLING_AVERAGES.items():
+        if key in config:
+            conf = config[key]
+            sens = await sensor.new_sensor(conf)
+            cg.add(hub.add_rolling_average(
+                channel,
+                sens,
+                conf[CONF_WINDOW].total_milliseconds,
+                conf[CONF_BUCKETS],
+            ))
+
+    # Per-channel deadband/heartbeat (applied before publish_state)
+    for key, channel in MEASUREMENT_CHANNELS.items():
+        if key not in config:
+            continue
+        conf = config[key]
+        if CONF_DEADBAND in conf or CONF_HEARTBEAT in conf:
+            deadband = conf.get(CONF_DEADBAND, 0.0)
+            heartbeat = conf.get(CONF_HEARTBEAT)
+            heartbeat_ms = heartbeat.total_milliseconds if heartbeat else 0
+            cg.add(hub.set_publish_filter(channel, deadband, heartbeat_ms))
+        if CONF_AGGREGATE in conf:
+            cg.add(hub.set_channel_aggregate(channel, conf[CONF_AGGREGATE]))
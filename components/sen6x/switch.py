@@ -3,12 +3,19 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import switch
-from esphome.const import CONF_ID, ENTITY_CATEGORY_CONFIG
+from esphome.components import time as time_
+from esphome.const import CONF_ID, CONF_TIME_ID, ENTITY_CATEGORY_CONFIG
 from . import Sen6xComponent, CONF_SEN6X_ID
 
 CONF_CO2_AUTOMATIC_SELF_CALIBRATION = "co2_automatic_self_calibration"
 CONF_AUTO_FAN_CLEANING = "auto_fan_cleaning"
 CONF_INTERVAL = "interval"
+CONF_BURST = "burst"
+CONF_QUIET_PERIOD = "quiet_period"
+CONF_START = "start"
+CONF_END = "end"
+CONF_MAX_PM_2_5_STDDEV = "max_pm_2_5_stddev"
+CONF_MAX_DELAY = "max_delay"
 
 sen6x_ns = cg.esphome_ns.namespace("sen6x")
 Sen6xSwitch = sen6x_ns.class_("Sen6xSwitch", switch.Switch)
@@ -16,6 +23,37 @@ Sen6xSwitch = sen6x_ns.class_("Sen6xSwitch", switch.Switch)
 # Default interval: 7 days = 604800 seconds
 DEFAULT_CLEANING_INTERVAL = 604800
 
+
+def validate_quiet_period(config):
+    window = [key for key in (CONF_TIME_ID, CONF_START, CONF_END) if key in config]
+    if window and len(window) != 3:
+        raise cv.Invalid(
+            f"'{CONF_TIME_ID}', '{CONF_START}' and '{CONF_END}' go together"
+        )
+    if not window and CONF_MAX_PM_2_5_STDDEV not in config:
+        raise cv.Invalid(
+            f"Set a time window ('{CONF_START}'/'{CONF_END}') and/or "
+            f"'{CONF_MAX_PM_2_5_STDDEV}'"
+        )
+    return config
+
+
+# A due cleaning waits for the time-of-day window and/or steady PM2.5 (needs
+# the pm_2_5 sensor), at most max_delay
+QUIET_PERIOD_SCHEMA = cv.All(
+    cv.Schema({
+        cv.Optional(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+        cv.Optional(CONF_START): cv.time_of_day,
+        cv.Optional(CONF_END): cv.time_of_day,
+        cv.Optional(CONF_MAX_PM_2_5_STDDEV): cv.float_range(min=0.1, max=100.0),
+        cv.Optional(CONF_MAX_DELAY, default="24h"): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(max=cv.TimePeriod(days=7)),
+        ),
+    }),
+    validate_quiet_period,
+)
+
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_SEN6X_ID): cv.use_id(Sen6xComponent),
     # voc_algorithm_tuning removed - now in sensor/voc_index/algorithm_tuning
@@ -29,13 +67,23 @@ CONFIG_SCHEMA = {
         icon="mdi:fan-auto",
         entity_category=ENTITY_CATEGORY_CONFIG,
     ).extend({
-        # Interval for auto-cleaning (default 7 days)
-        cv.Optional(CONF_INTERVAL, default="7d"): cv.positive_time_period_seconds,
+        # Fan runtime between cleanings (default 7 days), kept across reboots
+        cv.Optional(CONF_INTERVAL, default="7d"): cv.All(
+            cv.positive_time_period_seconds,
+            cv.Range(min=cv.TimePeriod(hours=1), max=cv.TimePeriod(days=49)),
+        ),
+        cv.Optional(CONF_QUIET_PERIOD): QUIET_PERIOD_SCHEMA,
     }),
+    # On while burst sampling runs; turning it on starts a burst
+    cv.Optional(CONF_BURST): switch.switch_schema(
+        Sen6xSwitch,
+        icon="mdi:timer-play",
+    ),
 }
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
+    cg.add_define("USE_SEN6X_SWITCH")
 
     if CONF_CO2_AUTOMATIC_SELF_CALIBRATION in config:
         s = await switch.new_switch(config[CONF_CO2_AUTOMATIC_SELF_CALIBRATION])
@@ -48,4 +96,26 @@ async def to_code(config):
         # Pass interval in milliseconds
         interval_seconds = auto_clean_config[CONF_INTERVAL].total_seconds
         cg.add(hub.set_auto_cleaning_interval(int(interval_seconds * 1000)))
+        if CONF_QUIET_PERIOD in auto_clean_config:
+            quiet = auto_clean_config[CONF_QUIET_PERIOD]
+            cg.add(
+                hub.set_auto_cleaning_quiet_period(
+                    quiet.get(CONF_MAX_PM_2_5_STDDEV, cg.RawExpression("NAN")),
+                    quiet[CONF_MAX_DELAY].total_milliseconds,
+                )
+            )
+            if CONF_TIME_ID in quiet:
+                cg.add_define("USE_SEN6X_CLEANING_CLOCK")
+                clock = await cg.get_variable(quiet[CONF_TIME_ID])
+                cg.add(
+                    hub.set_auto_cleaning_quiet_window(
+                        clock,
+                        quiet[CONF_START]["hour"] * 60 + quiet[CONF_START]["minute"],
+                        quiet[CONF_END]["hour"] * 60 + quiet[CONF_END]["minute"],
+                    )
+                )
 
+    if CONF_BURST in config:
+        cg.add_define("USE_SEN6X_BURST")
+        s = await switch.new_switch(config[CONF_BURST])
+        cg.add(hub.set_burst_switch(s))
@@ -9,6 +9,8 @@ CONF_PRODUCT_NAME = "product_name"
 CONF_SERIAL_NUMBER = "serial_number"
 CONF_STATUS_HEX = "status_hex"
 CONF_FIRMWARE_VERSION = "firmware_version"
+CONF_TELEMETRY_FRAME = "telemetry_frame"
+CONF_BUS_STATE = "bus_state"
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_SEN6X_ID): cv.use_id(Sen6xComponent),
@@ -28,10 +30,21 @@ CONFIG_SCHEMA = {
         icon="mdi:memory",
         entity_category="diagnostic",
     ),
+    # Whole cycle as one base64 frame (layout in sen6x_telemetry.h); carries
+    # every measured channel whether or not its own sensor is configured
+    cv.Optional(CONF_TELEMETRY_FRAME): text_sensor.text_sensor_schema(
+        icon="mdi:package-variant-closed",
+    ),
+    # Circuit breaker state: CLOSED, OPEN (backing off) or HALF_OPEN (probing)
+    cv.Optional(CONF_BUS_STATE): text_sensor.text_sensor_schema(
+        icon="mdi:lan-check",
+        entity_category="diagnostic",
+    ),
 }
 
 async def to_code(config):
     hub = await cg.get_variable(config[CONF_SEN6X_ID])
+    cg.add_define("USE_SEN6X_TEXT_SENSOR")
 
     if CONF_PRODUCT_NAME in config:
         sens = await text_sensor.new_text_sensor(config[CONF_PRODUCT_NAME])
@@ -49,3 +62,13 @@ async def to_code(config):
         sens = await text_sensor.new_text_sensor(config[CONF_FIRMWARE_VERSION])
         cg.add(hub.set_firmware_version_sensor(sens))
 
+    if CONF_TELEMETRY_FRAME in config:
+        cg.add_define("USE_SEN6X_TELEMETRY")
+        # The frame includes Number Concentration (0x0316 read every cycle)
+        cg.add_define("USE_SEN6X_NUMBER_CONCENTRATION")
+        sens = await text_sensor.new_text_sensor(config[CONF_TELEMETRY_FRAME])
+        cg.add(hub.set_telemetry_frame_text_sensor(sens))
+
+    if CONF_BUS_STATE in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_BUS_STATE])
+        cg.add(hub.set_bus_state_text_sensor(sens))
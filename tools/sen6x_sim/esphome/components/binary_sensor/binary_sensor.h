@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Host shim: binary sensor entity that counts publishes.
+
+#pragma once
+
+#include "esphome/core/helpers.h"
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor {
+public:
+  explicit BinarySensor(const std::string &name = "") : name_(name) {}
+
+  void publish_state(bool state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->publish_count_++;
+    this->callback_.call(state);
+  }
+  void add_on_state_callback(std::function<void(bool)> &&callback) {
+    this->callback_.add(std::move(callback));
+  }
+  bool has_state() const { return this->has_state_; }
+  const std::string &get_name() const { return this->name_; }
+  void set_internal(bool internal) {}
+
+  uint32_t get_publish_count() const { return this->publish_count_; }
+
+  bool state{false};
+
+protected:
+  std::string name_;
+  bool has_state_{false};
+  uint32_t publish_count_{0};
+  CallbackManager<void(bool)> callback_;
+};
+
+} // namespace binary_sensor
+} // namespace esphome
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: MIT
+// Host shim: button entity, pressed directly by the harness.
+
+#pragma once
+
+#include <string>
+
+namespace esphome {
+namespace button {
+
+class Button {
+public:
+  explicit Button(const std::string &name = "") : name_(name) {}
+  virtual ~Button() = default;
+
+  void press() { this->press_action(); }
+  const std::string &get_name() const { return this->name_; }
+  void set_internal(bool internal) {}
+
+protected:
+  virtual void press_action() = 0;
+
+  std::string name_;
+};
+
+} // namespace button
+} // namespace esphome
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Host shim: I2CDevice forwarding plain reads/writes to an I2CBus, which the
+// harness implements with the simulated sensor (sen6x_mock.h).
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace i2c {
+
+enum ErrorCode {
+  NO_ERROR = 0,
+  ERROR_OK = 0,
+  ERROR_INVALID_ARGUMENT = 1,
+  ERROR_NOT_ACKNOWLEDGED = 2,
+  ERROR_TIMEOUT = 3,
+  ERROR_NOT_INITIALIZED = 4,
+  ERROR_TOO_LARGE = 5,
+  ERROR_UNKNOWN = 6,
+  ERROR_CRC = 7,
+};
+
+class I2CBus {
+public:
+  virtual ~I2CBus() = default;
+  virtual ErrorCode read(uint8_t address, uint8_t *data, size_t len) = 0;
+  virtual ErrorCode write(uint8_t address, const uint8_t *data, size_t len,
+                          bool stop) = 0;
+};
+
+class I2CDevice {
+public:
+  void set_i2c_address(uint8_t address) { this->address_ = address; }
+  void set_i2c_bus(I2CBus *bus) { this->bus_ = bus; }
+  uint8_t get_i2c_address() const { return this->address_; }
+
+  ErrorCode read(uint8_t *data, size_t len) {
+    if (this->bus_ == nullptr)
+      return ERROR_NOT_INITIALIZED;
+    return this->bus_->read(this->address_, data, len);
+  }
+  ErrorCode write(const uint8_t *data, size_t len, bool stop = true) {
+    if (this->bus_ == nullptr)
+      return ERROR_NOT_INITIALIZED;
+    return this->bus_->write(this->address_, data, len, stop);
+  }
+
+protected:
+  uint8_t address_{0x00};
+  I2CBus *bus_{nullptr};
+};
+
+} // namespace i2c
+} // namespace esphome
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+// Host shim: sensor entity that counts publishes.
+
+#pragma once
+
+#include "esphome/core/helpers.h"
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace sensor {
+
+class Sensor {
+public:
+  explicit Sensor(const std::string &name = "") : name_(name) {}
+
+  void publish_state(float state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->publish_count_++;
+    this->callback_.call(state);
+  }
+  void add_on_state_callback(std::function<void(float)> &&callback) {
+    this->callback_.add(std::move(callback));
+  }
+
+  float get_state() const { return this->state; }
+  bool has_state() const { return this->has_state_; }
+  const std::string &get_name() const { return this->name_; }
+  void set_internal(bool internal) { this->internal_ = internal; }
+  bool is_internal() const { return this->internal_; }
+  void set_disabled_by_default(bool disabled) {}
+
+  uint32_t get_publish_count() const { return this->publish_count_; }
+
+  float state{NAN};
+
+protected:
+  std::string name_;
+  bool has_state_{false};
+  bool internal_{false};
+  uint32_t publish_count_{0};
+  CallbackManager<void(float)> callback_;
+};
+
+} // namespace sensor
+} // namespace esphome
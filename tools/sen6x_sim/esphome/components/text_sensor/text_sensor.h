@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: MIT
+// Host shim: text sensor entity that counts publishes.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace esphome {
+namespace text_sensor {
+
+class TextSensor {
+public:
+  explicit TextSensor(const std::string &name = "") : name_(name) {}
+
+  void publish_state(const std::string &state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->publish_count_++;
+  }
+  bool has_state() const { return this->has_state_; }
+  const std::string &get_name() const { return this->name_; }
+  void set_internal(bool internal) {}
+
+  uint32_t get_publish_count() const { return this->publish_count_; }
+
+  std::string state;
+
+protected:
+  std::string name_;
+  bool has_state_{false};
+  uint32_t publish_count_{0};
+};
+
+} // namespace text_sensor
+} // namespace esphome
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: MIT
+// Host shim: the App singleton (only loop timing is used).
+
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+
+class Application {
+public:
+  uint32_t get_loop_component_start_time() const { return millis(); }
+};
+
+extern Application App; // NOLINT
+
+} // namespace esphome
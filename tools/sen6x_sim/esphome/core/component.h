@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+// Host shim: Component / PollingComponent on the simulated scheduler. Timers
+// follow ESPHome semantics: a named timeout or interval replaces the previous
+// one with the same name, intervals are rescheduled from their due time.
+
+#pragma once
+
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace esphome {
+
+namespace setup_priority {
+static const float BUS = 1000.0f;
+static const float IO = 900.0f;
+static const float HARDWARE = 800.0f;
+static const float DATA = 600.0f;
+static const float PROCESSOR = 400.0f;
+static const float AFTER_WIFI = 200.0f;
+static const float AFTER_CONNECTION = 100.0f;
+static const float LATE = -100.0f;
+} // namespace setup_priority
+
+// Host CPU time spent in a component, filled in by the simulated main loop
+struct SimProfile {
+  uint32_t loop_calls;
+  uint64_t loop_ns;
+  uint32_t update_calls;
+  uint64_t update_ns;
+  uint64_t update_max_ns;
+};
+
+class Component {
+public:
+  virtual ~Component() = default;
+
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual void on_shutdown() {}
+  virtual float get_setup_priority() const { return setup_priority::DATA; }
+  virtual float get_loop_priority() const { return 0.0f; }
+  virtual void call_setup() { this->setup(); }
+
+  void mark_failed() { this->failed_ = true; }
+  bool is_failed() const { return this->failed_; }
+  bool is_ready() const { return !this->failed_; }
+
+  bool status_has_warning() const { return this->warning_; }
+  bool status_has_error() const { return this->error_; }
+  void status_set_warning(const char *message = "unspecified") {
+    this->warning_ = true;
+  }
+  void status_clear_warning() { this->warning_ = false; }
+  void status_set_error(const char *message = "unspecified") {
+    this->error_ = true;
+  }
+  void status_clear_error() { this->error_ = false; }
+
+  SimProfile &sim_profile() { return this->profile_; }
+
+protected:
+  void set_timeout(const std::string &name, uint32_t timeout,
+                   std::function<void()> &&f);
+  void set_timeout(uint32_t timeout, std::function<void()> &&f);
+  bool cancel_timeout(const std::string &name);
+  void set_interval(const std::string &name, uint32_t interval,
+                    std::function<void()> &&f);
+  void set_interval(uint32_t interval, std::function<void()> &&f);
+  bool cancel_interval(const std::string &name);
+  void defer(std::function<void()> &&f);
+  void defer(const std::string &name, std::function<void()> &&f);
+
+  bool failed_{false};
+  bool warning_{false};
+  bool error_{false};
+  SimProfile profile_{};
+};
+
+class PollingComponent : public Component {
+public:
+  PollingComponent() : PollingComponent(0) {}
+  explicit PollingComponent(uint32_t update_interval)
+      : update_interval_(update_interval) {}
+
+  virtual void set_update_interval(uint32_t update_interval) {
+    this->update_interval_ = update_interval;
+  }
+  virtual uint32_t get_update_interval() const {
+    return this->update_interval_;
+  }
+  virtual void update() = 0;
+
+  void call_setup() override;
+  void start_poller();
+  void stop_poller();
+
+protected:
+  uint32_t update_interval_;
+};
+
+} // namespace esphome
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: MIT
+// Host shim: stands in for the codegen-generated defines.h. The harness
+// builds the sensor-side feature set (all channels, identity/status entities,
+// diagnostics, raw capture, the telemetry frame, burst sampling, duty
+// cycling, rolling averages and the flash-write, duty-ratio, CO2-correction
+// and heater sensors, and the buttons); number and switch platforms and the
+// ESP32 sensor task are not simulated.
+
+#pragma once
+
+#define USE_SEN6X_TVOC
+#define USE_SEN6X_NUMBER_CONCENTRATION
+#define USE_SEN6X_TEXT_SENSOR
+#define USE_SEN6X_BINARY_SENSOR
+#define USE_SEN6X_BUTTON
+#define USE_SEN6X_DIAGNOSTICS
+#define USE_SEN6X_CAPTURE
+#define USE_SEN6X_TELEMETRY
+#define USE_SEN6X_BURST
+#define USE_SEN6X_DUTY_CYCLE
+#define USE_SEN6X_ROLLING_AVERAGE
+#define USE_SEN6X_FLASH_WRITES
+#define USE_SEN6X_DUTY_RATIO
+#define USE_SEN6X_CO2_CORRECTION
+#define USE_SEN6X_HEATER_SENSORS
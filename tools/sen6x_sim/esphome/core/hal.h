@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: MIT
+// Host shim: ESPHome HAL on the simulated clock (see sim_runtime.h). delay()
+// advances the clock instead of sleeping.
+
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+} // namespace esphome
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Host shim: the subset of esphome/core/helpers.h used by the component.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+
+template <typename T> using optional = std::optional<T>;
+
+template <typename T> class Parented {
+public:
+  Parented() {}
+  Parented(T *parent) : parent_(parent) {}
+  T *get_parent() const { return parent_; }
+  void set_parent(T *parent) { parent_ = parent; }
+
+protected:
+  T *parent_{nullptr};
+};
+
+template <typename... X> class CallbackManager;
+
+template <typename... Ts> class CallbackManager<void(Ts...)> {
+public:
+  void add(std::function<void(Ts...)> &&callback) {
+    this->callbacks_.push_back(std::move(callback));
+  }
+  void call(Ts... args) {
+    for (auto &callback : this->callbacks_)
+      callback(args...);
+  }
+  size_t size() const { return this->callbacks_.size(); }
+
+protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+
+template <typename T> T clamp(T value, T min, T max) {
+  return value < min ? min : (value > max ? max : value);
+}
+
+uint32_t fnv1_hash(const std::string &str);
+std::string base64_encode(const uint8_t *buf, size_t buf_len);
+
+} // namespace esphome
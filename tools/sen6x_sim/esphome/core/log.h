@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Host shim: ESPHome logging macros, printed to stderr above the runtime log
+// level (sen6x_sim::set_log_level()).
+
+#pragma once
+
+#include <cstdio>
+
+#define ESPHOME_LOG_LEVEL_NONE 0
+#define ESPHOME_LOG_LEVEL_ERROR 1
+#define ESPHOME_LOG_LEVEL_WARN 2
+#define ESPHOME_LOG_LEVEL_INFO 3
+#define ESPHOME_LOG_LEVEL_CONFIG 4
+#define ESPHOME_LOG_LEVEL_DEBUG 5
+#define ESPHOME_LOG_LEVEL_VERBOSE 6
+#define ESPHOME_LOG_LEVEL_VERY_VERBOSE 7
+
+namespace esphome {
+
+void esp_log_printf_(int level, const char *tag, int line, const char *format,
+                     ...) __attribute__((format(printf, 4, 5)));
+
+} // namespace esphome
+
+#define ESP_LOGE(tag, ...)                                                     \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_ERROR, tag, __LINE__,           \
+                             __VA_ARGS__)
+#define ESP_LOGW(tag, ...)                                                     \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_WARN, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGI(tag, ...)                                                     \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_INFO, tag, __LINE__, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...)                                                \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_CONFIG, tag, __LINE__,          \
+                             __VA_ARGS__)
+#define ESP_LOGD(tag, ...)                                                     \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_DEBUG, tag, __LINE__,           \
+                             __VA_ARGS__)
+#define ESP_LOGV(tag, ...)                                                     \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_VERBOSE, tag, __LINE__,         \
+                             __VA_ARGS__)
+#define ESP_LOGVV(tag, ...)                                                    \
+  ::esphome::esp_log_printf_(ESPHOME_LOG_LEVEL_VERY_VERBOSE, tag, __LINE__,    \
+                             __VA_ARGS__)
+
+// Entity helpers use the caller's TAG, as in ESPHome
+#define LOG_SENSOR(prefix, type, obj)                                          \
+  if ((obj) != nullptr) {                                                      \
+    ESP_LOGCONFIG(TAG, "%s%s '%s'", prefix, type, (obj)->get_name().c_str());  \
+  }
+#define LOG_TEXT_SENSOR(prefix, type, obj) LOG_SENSOR(prefix, type, obj)
+#define LOG_BINARY_SENSOR(prefix, type, obj) LOG_SENSOR(prefix, type, obj)
+#define LOG_I2C_DEVICE(this)                                                   \
+  ESP_LOGCONFIG(TAG, "  Address: 0x%02X", (this)->get_i2c_address())
+#define LOG_UPDATE_INTERVAL(this)                                              \
+  ESP_LOGCONFIG(TAG, "  Update Interval: %.1fs",                               \
+                (this)->get_update_interval() / 1000.0f)
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Host shim: ESPHome preferences API backed by the in-memory store of the
+// runtime (sen6x_sim::SimPreferences), which counts flash writes.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+class ESPPreferenceBackend {
+public:
+  virtual ~ESPPreferenceBackend() = default;
+  virtual bool save(const uint8_t *data, size_t len) = 0;
+  virtual bool load(uint8_t *data, size_t len) = 0;
+};
+
+class ESPPreferenceObject {
+public:
+  ESPPreferenceObject() = default;
+  explicit ESPPreferenceObject(ESPPreferenceBackend *backend)
+      : backend_(backend) {}
+
+  template <typename T> bool save(const T *src) {
+    if (this->backend_ == nullptr)
+      return false;
+    return this->backend_->save(reinterpret_cast<const uint8_t *>(src),
+                                sizeof(T));
+  }
+  template <typename T> bool load(T *dest) {
+    if (this->backend_ == nullptr)
+      return false;
+    return this->backend_->load(reinterpret_cast<uint8_t *>(dest), sizeof(T));
+  }
+
+protected:
+  ESPPreferenceBackend *backend_{nullptr};
+};
+
+class ESPPreferences {
+public:
+  virtual ~ESPPreferences() = default;
+  virtual ESPPreferenceObject make_preference(size_t length, uint32_t type,
+                                              bool in_flash) = 0;
+  virtual bool sync() = 0;
+
+  template <typename T>
+  ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
+    return this->make_preference(sizeof(T), type, in_flash);
+  }
+  template <typename T> ESPPreferenceObject make_preference(uint32_t type) {
+    return this->make_preference(sizeof(T), type, false);
+  }
+};
+
+extern ESPPreferences *global_preferences; // NOLINT
+
+} // namespace esphome
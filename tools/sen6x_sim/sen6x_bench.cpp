@@ -0,0 +1,605 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - benchmark
+// Boots Sen6xComponent against the simulated sensor for every model and
+// scenario and reports boot time, update() CPU time, bus traffic and publish
+// counts per update cycle. Exits non-zero when a run fails to boot or a
+// fault-free run shows protocol errors or missing frames.
+//
+// Build and run from the repository root (no ESPHome checkout needed):
+//   g++ -std=gnu++17 -O2 -Itools/sen6x_sim -Icomponents/sen6x
+//       tools/sen6x_sim/sim_runtime.cpp tools/sen6x_sim/sen6x_mock.cpp
+//       tools/sen6x_sim/sen6x_bench.cpp components/sen6x/sen6x.cpp
+//       -o sen6x_bench
+//   ./sen6x_bench [--model SEN66] [--scenario interval] [--cycles 60]
+//
+// Simulated values (boot time, bytes, publishes) are deterministic for a
+// seed; CPU times are host wall time and only comparable on one machine.
+
+#include "sen6x.h"
+#include "sen6x_bus_scheduler.h"
+#include "sen6x_mock.h"
+#include "sim_runtime.h"
+#include "esphome/core/log.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using esphome::sen6x::Sen6xChannel;
+using esphome::sen6x::Sen6xButton;
+using esphome::sen6x::Sen6xComponent;
+using esphome::sen6x::Sen6xIdleAction;
+using esphome::sen6x::Sen6xPollGroup;
+using esphome::sen6x::Sen6xPollingMode;
+using esphome::sen6x::Sen6xWarmUpGroup;
+using namespace sen6x_sim;
+
+namespace {
+
+struct BenchOptions {
+  uint32_t update_interval_ms{10000};
+  uint32_t cycles{60};
+  uint32_t seed{1};
+  float nack_rate{0.02f};
+  float crc_rate{0.01f};
+  uint32_t latency_us{200};
+  bool csv{false};
+};
+
+// Scenarios start from the plain INTERVAL run; each one then switches on
+// the features it exercises, e.g. Scenario{"x", "..."}.with(&Scenario::duty)
+struct Scenario {
+  const char *name;
+  const char *description;
+  Sen6xPollingMode polling_mode{Sen6xPollingMode::INTERVAL};
+  bool decimate_and_filter{false}; // NC every 6th cycle, deadbands everywhere
+  bool inject_faults{false};
+  bool telemetry_only{false}; // One packed frame per cycle, no channel entities
+  bool burst{false};       // 1 s burst sampling over the first half of the run
+  bool duty{false};        // Measurement stopped between samples
+  bool unplug{false};      // Sensor detached from 30% to 55% of the run
+  bool warm_boot{false};   // Preferences (identity cache) from an earlier boot
+  bool heater{false};      // One SHT heater cycle at 30% of the run
+  bool calibration{false}; // Stability-gated FRC requested at 10% and 80%
+  bool restart_gap{false};  // Config changes and device resets within 24 s
+
+  Scenario with(bool Scenario::*feature) const {
+    Scenario scenario = *this;
+    scenario.*feature = true;
+    return scenario;
+  }
+  Scenario with_polling_mode(Sen6xPollingMode mode) const {
+    Scenario scenario = *this;
+    scenario.polling_mode = mode;
+    return scenario;
+  }
+};
+
+const Scenario SCENARIOS[] = {
+    Scenario{"interval", "data-ready probe + frame every update"},
+    Scenario{"phase_locked", "reads scheduled after the data-ready edge"}
+        .with_polling_mode(Sen6xPollingMode::PHASE_LOCKED),
+    Scenario{"decimated", "NC every 6th update, deadband publishing"}.with(
+        &Scenario::decimate_and_filter),
+    Scenario{"faulty", "NACK/CRC errors and bus latency injected"}.with(
+        &Scenario::inject_faults),
+    Scenario{"telemetry", "telemetry_frame text sensor only"}.with(
+        &Scenario::telemetry_only),
+    Scenario{"burst", "1 s burst sampling for the first half of the run"}
+        .with(&Scenario::burst),
+    Scenario{"duty", "stopped between samples, one sample per 6 updates"}
+        .with(&Scenario::duty),
+    Scenario{"unplug",
+             "sensor detached for a quarter of the run, then power cycled"}
+        .with(&Scenario::unplug),
+    Scenario{"warm_boot", "second boot of the same sensor (cached identity)"}
+        .with(&Scenario::warm_boot),
+    Scenario{"heater", "one SHT heater cycle with readback and 20 s cooldown"}
+        .with(&Scenario::heater),
+    Scenario{"calibration",
+             "FRC behind the CO2 stability gate (early and settled)"}
+        .with(&Scenario::calibration),
+    Scenario{"restart_gap", "config change and device reset inside 24 s"}
+        .with(&Scenario::restart_gap),
+};
+
+// Idle-only configuration requested the way a number or switch change
+// requests it (those platforms are not simulated)
+class BenchComponent : public Sen6xComponent {
+public:
+  void request_altitude(float altitude) {
+    this->request_idle_configuration_(Sen6xIdleAction::ALTITUDE, altitude);
+  }
+};
+
+struct BenchResult {
+  bool booted;
+  uint32_t boot_ms;
+  uint32_t updates;
+  double update_avg_us;
+  double update_max_us;
+  double loop_us_per_cycle;
+  double bytes_per_cycle;
+  double transfers_per_cycle;
+  double publishes_per_cycle;
+  uint32_t frames;
+  MockStats boot; // Up to the ready callback
+  MockStats mock; // Measured cycles
+  uint32_t flash_writes;
+  uint32_t updates_after_plug_in; // unplug: from the plug-in on
+  uint32_t frames_after_plug_in;
+  float heater_temperature; // heater: published readback (NAN = none)
+  uint16_t heater_activations;
+  bool calibration_accepted[2]; // calibration: early / settled request
+  uint16_t forced_recalibrations;
+  float co2_correction; // Published FRC correction (NAN = none)
+  int16_t altitude_m;    // Sensor altitude setting at the end of the run
+  uint16_t device_resets;
+  uint32_t updates_after_restarts; // restart_gap: once both rounds are over
+  uint32_t frames_after_restarts;
+  bool measuring; // Sensor in measurement mode at the end of the run
+};
+
+// Entities a full YAML configuration would create
+struct BenchEntities {
+  std::vector<std::unique_ptr<esphome::sensor::Sensor>> sensors;
+  std::vector<std::unique_ptr<esphome::text_sensor::TextSensor>> text_sensors;
+  std::vector<std::unique_ptr<esphome::binary_sensor::BinarySensor>>
+      binary_sensors;
+
+  esphome::sensor::Sensor *sensor(const char *name) {
+    this->sensors.push_back(std::make_unique<esphome::sensor::Sensor>(name));
+    return this->sensors.back().get();
+  }
+  esphome::text_sensor::TextSensor *text_sensor(const char *name) {
+    this->text_sensors.push_back(
+        std::make_unique<esphome::text_sensor::TextSensor>(name));
+    return this->text_sensors.back().get();
+  }
+  esphome::binary_sensor::BinarySensor *binary_sensor(const char *name) {
+    this->binary_sensors.push_back(
+        std::make_unique<esphome::binary_sensor::BinarySensor>(name));
+    return this->binary_sensors.back().get();
+  }
+  uint32_t publish_count() const {
+    uint32_t count = 0;
+    for (const auto &sens : this->sensors)
+      count += sens->get_publish_count();
+    for (const auto &sens : this->text_sensors)
+      count += sens->get_publish_count();
+    for (const auto &sens : this->binary_sensors)
+      count += sens->get_publish_count();
+    return count;
+  }
+};
+
+void configure_entities(Sen6xComponent &component, BenchEntities &entities) {
+  component.set_pm_1_0_sensor(entities.sensor("PM1.0"));
+  component.set_pm_2_5_sensor(entities.sensor("PM2.5"));
+  component.set_pm_4_0_sensor(entities.sensor("PM4.0"));
+  component.set_pm_10_0_sensor(entities.sensor("PM10.0"));
+  component.set_humidity_sensor(entities.sensor("Humidity"));
+  component.set_temperature_sensor(entities.sensor("Temperature"));
+  component.set_voc_index_sensor(entities.sensor("VOC Index"));
+  component.set_nox_index_sensor(entities.sensor("NOx Index"));
+  component.set_co2_sensor(entities.sensor("CO2"));
+  component.set_formaldehyde_sensor(entities.sensor("Formaldehyde"));
+  component.set_tvoc_well_sensor(entities.sensor("TVOC WELL"));
+  component.set_tvoc_reset_sensor(entities.sensor("TVOC RESET"));
+  component.set_tvoc_ethanol_sensor(entities.sensor("TVOC Ethanol"));
+  component.set_nc_0_5_sensor(entities.sensor("NC0.5"));
+  component.set_nc_1_0_sensor(entities.sensor("NC1.0"));
+  component.set_nc_2_5_sensor(entities.sensor("NC2.5"));
+  component.set_nc_4_0_sensor(entities.sensor("NC4.0"));
+  component.set_nc_10_0_sensor(entities.sensor("NC10.0"));
+  component.set_ambient_pressure_sensor(entities.sensor("Ambient Pressure"));
+  component.set_sensor_altitude_sensor(entities.sensor("Sensor Altitude"));
+  component.set_product_name_text_sensor(entities.text_sensor("Product"));
+  component.set_serial_number_text_sensor(entities.text_sensor("Serial"));
+  component.set_status_text_sensor(entities.text_sensor("Status"));
+  component.set_firmware_version_sensor(entities.text_sensor("Firmware"));
+  component.set_fan_error_binary_sensor(entities.binary_sensor("Fan Error"));
+  component.set_gas_error_binary_sensor(entities.binary_sensor("Gas Error"));
+  component.set_rht_error_binary_sensor(entities.binary_sensor("RHT Error"));
+  component.set_pm_error_binary_sensor(entities.binary_sensor("PM Error"));
+}
+
+void configure_filters(Sen6xComponent &component) {
+  component.set_decimation(Sen6xPollGroup::NUMBER_CONCENTRATION, 6);
+  const struct {
+    Sen6xChannel channel;
+    float deadband;
+  } deadbands[] = {
+      {Sen6xChannel::PM_1_0, 1.0f},      {Sen6xChannel::PM_2_5, 1.0f},
+      {Sen6xChannel::PM_4_0, 1.0f},      {Sen6xChannel::PM_10_0, 1.0f},
+      {Sen6xChannel::HUMIDITY, 0.5f},    {Sen6xChannel::TEMPERATURE, 0.1f},
+      {Sen6xChannel::VOC_INDEX, 5.0f},   {Sen6xChannel::NOX_INDEX, 1.0f},
+      {Sen6xChannel::CO2, 20.0f},        {Sen6xChannel::FORMALDEHYDE, 2.0f},
+  };
+  for (const auto &entry : deadbands)
+    component.set_publish_filter(entry.channel, entry.deadband, 300000);
+}
+
+// Boots and shuts down one instance so the next boot finds its preferences
+void prime_preferences(MockModel model, const BenchOptions &options) {
+  Sen6xMock mock(model, options.seed);
+  SimApp app;
+  Sen6xComponent component;
+  component.set_i2c_bus(&mock);
+  component.set_i2c_address(0x6B);
+  component.set_update_interval(options.update_interval_ms);
+  bool ready = false;
+  component.add_on_ready_callback([&]() { ready = true; });
+  app.register_component(&component);
+  app.register_component(&esphome::sen6x::global_sen6x_bus_scheduler);
+  app.setup();
+  app.run_until([&]() { return ready; }, 30000);
+  app.shutdown();
+}
+
+BenchResult run_bench(MockModel model, const Scenario &scenario,
+                      const BenchOptions &options) {
+  BenchResult result{};
+  preferences().clear();
+  if (scenario.warm_boot)
+    prime_preferences(model, options);
+  reset_clock();
+  // Every run is a fresh boot with one instance on the shared scheduler
+  esphome::sen6x::global_sen6x_bus_scheduler =
+      esphome::sen6x::Sen6xBusScheduler();
+
+  Sen6xMock mock(model, options.seed);
+  if (scenario.inject_faults) {
+    mock.faults().write_nack_rate = options.nack_rate;
+    mock.faults().read_nack_rate = options.nack_rate;
+    mock.faults().crc_error_rate = options.crc_rate;
+    mock.faults().latency_us = options.latency_us;
+  }
+
+  SimApp app;
+  BenchComponent component;
+  BenchEntities entities;
+  component.set_i2c_bus(&mock);
+  component.set_i2c_address(0x6B);
+  component.set_update_interval(options.update_interval_ms);
+  component.set_polling_mode(scenario.polling_mode);
+  if (scenario.telemetry_only) {
+    component.set_telemetry_frame_text_sensor(
+        entities.text_sensor("Telemetry Frame"));
+  } else {
+    configure_entities(component, entities);
+  }
+  if (scenario.decimate_and_filter)
+    configure_filters(component);
+  esphome::sensor::Sensor *heater_temperature = nullptr;
+  if (scenario.heater) {
+    heater_temperature = entities.sensor("Heater Temperature");
+    component.set_heater_humidity_sensor(entities.sensor("Heater Humidity"));
+    component.set_heater_temperature_sensor(heater_temperature);
+  }
+  esphome::sensor::Sensor *co2_correction = nullptr;
+  if (scenario.calibration) {
+    // Ten samples (100 s) within 40 ppm; the mock's CO2 drifts slowly
+    co2_correction = entities.sensor("CO2 Correction");
+    component.set_co2_correction_sensor(co2_correction);
+    component.set_co2_calibration_gate(10, 40, NAN);
+  }
+  Sen6xButton reset_button;
+  if (scenario.restart_gap)
+    component.set_device_reset_button(&reset_button);
+  if (scenario.unplug) {
+    component.set_bus_fault_binary_sensor(entities.binary_sensor("Bus Fault"));
+    component.set_bus_state_text_sensor(entities.text_sensor("Bus State"));
+  }
+  if (scenario.duty) {
+    // Gas/CO2/HCHO warm up over two updates, PM and RH/T over one
+    uint32_t interval = options.update_interval_ms;
+    component.set_duty_cycle(6 * interval);
+    component.set_warm_up(Sen6xWarmUpGroup::PM, interval);
+    component.set_warm_up(Sen6xWarmUpGroup::RHT, interval);
+    component.set_warm_up(Sen6xWarmUpGroup::GAS, 2 * interval);
+    component.set_warm_up(Sen6xWarmUpGroup::CO2, 2 * interval);
+    component.set_warm_up(Sen6xWarmUpGroup::FORMALDEHYDE, 2 * interval);
+    component.set_duty_ratio_sensor(entities.sensor("Duty Ratio"));
+  }
+
+  bool ready = false;
+  component.add_on_ready_callback([&]() {
+    ready = true;
+    result.boot_ms = esphome::millis();
+  });
+  app.register_component(&component);
+  app.register_component(&esphome::sen6x::global_sen6x_bus_scheduler);
+  app.setup();
+  result.booted = app.run_until([&]() { return ready; }, 30000);
+  if (!result.booted)
+    return result;
+
+  // The component skips updates for 10 s after boot (fan cleaning settle
+  // window); at 1 s that would show up as missed frames
+  if (scenario.burst)
+    app.run_for(10000);
+
+  // Measure whole update cycles from here (boot traffic kept separately)
+  result.boot = mock.stats();
+  mock.reset_stats();
+  esphome::SimProfile start_profile = component.sim_profile();
+  uint32_t start_publishes = entities.publish_count();
+  if (scenario.burst)
+    component.start_burst(options.cycles * options.update_interval_ms / 2);
+  if (scenario.unplug) {
+    uint32_t run_ms = options.cycles * options.update_interval_ms;
+    app.run_for(run_ms * 3 / 10);
+    mock.unplug();
+    app.run_for(run_ms * 55 / 100 - run_ms * 3 / 10);
+    mock.plug_in();
+    uint32_t updates = component.sim_profile().update_calls;
+    uint32_t frames = mock.stats().frames_read;
+    app.run_for(run_ms - run_ms * 55 / 100);
+    result.updates_after_plug_in =
+        component.sim_profile().update_calls - updates;
+    result.frames_after_plug_in = mock.stats().frames_read - frames;
+  } else if (scenario.heater) {
+    uint32_t run_ms = options.cycles * options.update_interval_ms;
+    app.run_for(run_ms * 3 / 10);
+    component.activate_sht_heater();
+    app.run_for(run_ms - run_ms * 3 / 10);
+  } else if (scenario.calibration) {
+    uint32_t run_ms = options.cycles * options.update_interval_ms;
+    app.run_for(run_ms / 10);
+    result.calibration_accepted[0] = component.start_forced_co2_calibration();
+    app.run_for(run_ms * 8 / 10 - run_ms / 10);
+    result.calibration_accepted[1] = component.start_forced_co2_calibration();
+    app.run_for(run_ms - run_ms * 8 / 10);
+  } else if (scenario.restart_gap) {
+    // Round 1: the window's Start waits out the gap after the boot Start,
+    // then the reset button is pressed (refused while the window is open).
+    // Round 2: a reset's Start waits out the gap, then a window opens on
+    // top of it.
+    uint32_t run_ms = options.cycles * options.update_interval_ms;
+    component.request_altitude(100.0f);
+    app.run_for(6000);
+    reset_button.press();
+    app.run_for(34000);
+    reset_button.press();
+    app.run_for(3000);
+    component.request_altitude(250.0f);
+    app.run_for(17000);
+    uint32_t updates = component.sim_profile().update_calls;
+    uint32_t frames = mock.stats().frames_read;
+    app.run_for(run_ms > 60000 ? run_ms - 60000 : 0);
+    result.updates_after_restarts =
+        component.sim_profile().update_calls - updates;
+    result.frames_after_restarts = mock.stats().frames_read - frames;
+  } else {
+    app.run_for(options.cycles * options.update_interval_ms);
+  }
+  const esphome::SimProfile &profile = component.sim_profile();
+
+  result.updates = profile.update_calls - start_profile.update_calls;
+  double cycles = result.updates > 0 ? result.updates : 1;
+  result.update_avg_us =
+      (profile.update_ns - start_profile.update_ns) / 1000.0 / cycles;
+  result.update_max_us = profile.update_max_ns / 1000.0;
+  result.loop_us_per_cycle =
+      (profile.loop_ns - start_profile.loop_ns) / 1000.0 / cycles;
+  result.mock = mock.stats();
+  result.bytes_per_cycle =
+      (result.mock.bytes_written + result.mock.bytes_read) / cycles;
+  result.transfers_per_cycle =
+      (result.mock.writes + result.mock.reads) / cycles;
+  result.publishes_per_cycle =
+      (entities.publish_count() - start_publishes) / cycles;
+  result.frames = result.mock.frames_read;
+  result.measuring = mock.is_measuring();
+  result.heater_temperature =
+      heater_temperature != nullptr ? heater_temperature->get_state() : NAN;
+  result.heater_activations = mock.settings().heater_activations;
+  result.forced_recalibrations = mock.settings().forced_recalibrations;
+  result.co2_correction =
+      co2_correction != nullptr ? co2_correction->get_state() : NAN;
+  result.altitude_m = mock.settings().altitude_m;
+  result.device_resets = mock.settings().device_resets;
+
+  app.shutdown();
+  result.flash_writes = preferences().get_save_count();
+  return result;
+}
+
+// Protocol errors the component caused itself (injected faults excluded).
+// Commands a model does not implement are reported separately: the model
+// is only known once the product name has been read.
+uint32_t protocol_errors(const MockStats &stats) {
+  return stats.busy_nacks + stats.wrong_mode_commands +
+         stats.malformed_writes + stats.bad_request_crc +
+         stats.unexpected_reads + stats.early_starts;
+}
+
+bool parse_model(const char *name, MockModel *model) {
+  for (uint8_t i = 0; i < (uint8_t)MockModel::COUNT; i++) {
+    if (strcasecmp(name, mock_model_name((MockModel)i)) == 0) {
+      *model = (MockModel)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+void usage(const char *program) {
+  std::printf(
+      "Usage: %s [options]\n"
+      "  --model NAME       SEN62|SEN63C|SEN65|SEN66|SEN68|SEN69C (all)\n"
+      "  --scenario NAME    interval|phase_locked|decimated|faulty|telemetry|\n"
+      "                     burst|duty|unplug|warm_boot|heater|\n"
+      "                     calibration|restart_gap (all)\n"
+      "  --cycles N         update cycles measured per run (60)\n"
+      "  --interval MS      update_interval (10000)\n"
+      "  --seed N           simulation seed (1)\n"
+      "  --nack-rate P      faulty: NACK probability per transfer (0.02)\n"
+      "  --crc-rate P       faulty: CRC error probability per word (0.01)\n"
+      "  --latency-us N     faulty: extra latency per transfer (200)\n"
+      "  --log-level N      component log level, 0-7 (2 = WARN)\n"
+      "  --csv              machine-readable output\n",
+      program);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  BenchOptions options;
+  int model_filter = -1;
+  const char *scenario_filter = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (std::strcmp(arg, "--csv") == 0) {
+      options.csv = true;
+      continue;
+    }
+    if (std::strcmp(arg, "--help") == 0 || value == nullptr) {
+      usage(argv[0]);
+      return std::strcmp(arg, "--help") == 0 ? 0 : 2;
+    }
+    i++;
+    if (std::strcmp(arg, "--model") == 0) {
+      MockModel model;
+      if (!parse_model(value, &model)) {
+        std::fprintf(stderr, "Unknown model '%s'\n", value);
+        return 2;
+      }
+      model_filter = (int)model;
+    } else if (std::strcmp(arg, "--scenario") == 0) {
+      scenario_filter = value;
+    } else if (std::strcmp(arg, "--cycles") == 0) {
+      options.cycles = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(arg, "--interval") == 0) {
+      options.update_interval_ms = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(arg, "--seed") == 0) {
+      options.seed = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(arg, "--nack-rate") == 0) {
+      options.nack_rate = std::strtof(value, nullptr);
+    } else if (std::strcmp(arg, "--crc-rate") == 0) {
+      options.crc_rate = std::strtof(value, nullptr);
+    } else if (std::strcmp(arg, "--latency-us") == 0) {
+      options.latency_us = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(arg, "--log-level") == 0) {
+      set_log_level(std::atoi(value));
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if (options.csv) {
+    std::printf("model,scenario,boot_ms,updates,update_avg_us,update_max_us,"
+                "loop_us_per_cycle,bytes_per_cycle,transfers_per_cycle,"
+                "publishes_per_cycle,frames,injected_nacks,"
+                "injected_crc_errors,protocol_errors,unsupported_commands,"
+                "boot_bytes,flash_writes\n");
+  } else {
+    std::printf("%-7s %-13s %7s %8s %8s %9s %8s %7s %6s %6s %6s %5s %5s\n",
+                "model", "scenario", "boot_ms", "upd_us", "upd_max",
+                "loop_us/c", "bytes/c", "xfer/c", "pub/c", "frames",
+                "faults", "proto", "unsup");
+  }
+
+  int failures = 0;
+  for (uint8_t m = 0; m < (uint8_t)MockModel::COUNT; m++) {
+    if (model_filter >= 0 && model_filter != m)
+      continue;
+    for (const Scenario &scenario : SCENARIOS) {
+      if (scenario_filter != nullptr &&
+          std::strcmp(scenario_filter, scenario.name) != 0)
+        continue;
+      MockModel model = (MockModel)m;
+      BenchResult r = run_bench(model, scenario, options);
+
+      // A fault-free run reads one frame per update and never upsets the
+      // sensor; phase-locked reads may catch one more edge than updates
+      uint32_t errors = protocol_errors(r.boot) + protocol_errors(r.mock);
+      uint32_t unsupported =
+          r.boot.unsupported_commands + r.mock.unsupported_commands;
+      bool ok = r.booted;
+      if (ok && scenario.unplug) {
+        // The breaker keeps the bus quiet while detached (threshold plus
+        // one probe per backoff) and measurement resumes at the first probe
+        // after the power cycle. The doubling backoff never exceeds the time
+        // since the fault, so that probe is at most one outage away.
+        uint32_t probe_updates = options.cycles / 4 + 2;
+        ok = errors == 0 && r.mock.detached_nacks <= 20 &&
+             r.frames_after_plug_in + probe_updates >=
+                 r.updates_after_plug_in &&
+             r.measuring;
+      } else if (ok && scenario.heater) {
+        // The idle window stays open until 20 s after the activation
+        // (early starts count as protocol errors), about 23 s in total
+        uint32_t window_updates = 23000 / options.update_interval_ms + 2;
+        ok = errors == 0 && r.heater_activations == 1 &&
+             r.heater_temperature == 45.0f &&
+             r.frames + window_updates >= r.updates && r.measuring;
+      } else if (ok && scenario.calibration) {
+        // The early request is within 3 min of the start and lacks
+        // samples; the settled one runs on CO2 models (mock correction
+        // 0 ppm) and is refused on the others
+        bool co2 = model == MockModel::SEN63C || model == MockModel::SEN66 ||
+                   model == MockModel::SEN69C;
+        ok = errors == 0 && !r.calibration_accepted[0] &&
+             r.calibration_accepted[1] == co2 &&
+             r.forced_recalibrations == (co2 ? 1 : 0) &&
+             (co2 ? r.co2_correction == 0.0f : std::isnan(r.co2_correction)) &&
+             r.frames + 2 >= r.updates && r.measuring;
+      } else if (ok && scenario.restart_gap) {
+        // Every deferred Start is sent (no start within 24 s of the last
+        // on SEN63C/SEN69C), the windows close and measurement keeps going.
+        // The round 1 reset hits the still open window there and is refused.
+        // Only CO2 models implement the altitude setting.
+        bool co2 = model == MockModel::SEN63C || model == MockModel::SEN66 ||
+                   model == MockModel::SEN69C;
+        bool gap = model == MockModel::SEN63C || model == MockModel::SEN69C;
+        ok = errors == 0 && r.device_resets == (gap ? 1 : 2) &&
+             r.altitude_m == (co2 ? 250 : 0) &&
+             r.frames_after_restarts + 2 >= r.updates_after_restarts &&
+             r.updates_after_restarts > 0 && r.measuring;
+      } else if (ok && !scenario.inject_faults) {
+        ok = errors == 0 && r.frames + 1 >= r.updates;
+      }
+
+      if (options.csv) {
+        std::printf("%s,%s,%u,%u,%.2f,%.2f,%.2f,%.1f,%.2f,%.2f,%u,%u,%u,%u,"
+                    "%u,%u,%u\n",
+                    mock_model_name(model), scenario.name,
+                    (unsigned int)r.boot_ms, (unsigned int)r.updates,
+                    r.update_avg_us, r.update_max_us, r.loop_us_per_cycle,
+                    r.bytes_per_cycle, r.transfers_per_cycle,
+                    r.publishes_per_cycle, (unsigned int)r.frames,
+                    (unsigned int)r.mock.injected_nacks,
+                    (unsigned int)r.mock.injected_crc_errors,
+                    (unsigned int)errors, (unsigned int)unsupported,
+                    (unsigned int)(r.boot.bytes_written + r.boot.bytes_read),
+                    (unsigned int)r.flash_writes);
+      } else if (!r.booted) {
+        std::printf("%-7s %-13s   boot did not complete within 30 s\n",
+                    mock_model_name(model), scenario.name);
+      } else {
+        std::printf(
+            "%-7s %-13s %7u %8.2f %8.2f %9.2f %8.1f %7.2f %6.2f %6u %6u "
+            "%5u %5u%s\n",
+            mock_model_name(model), scenario.name, (unsigned int)r.boot_ms,
+            r.update_avg_us, r.update_max_us, r.loop_us_per_cycle,
+            r.bytes_per_cycle, r.transfers_per_cycle, r.publishes_per_cycle,
+            (unsigned int)r.frames,
+            (unsigned int)(r.mock.injected_nacks +
+                           r.mock.injected_crc_errors),
+            (unsigned int)errors, (unsigned int)unsupported,
+            ok ? "" : "  FAIL");
+      }
+      if (!ok)
+        failures++;
+    }
+  }
+  return failures > 0 ? 1 : 0;
+}
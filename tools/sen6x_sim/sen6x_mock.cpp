@@ -0,0 +1,507 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - simulated sensor (see sen6x_mock.h)
+
+#include "sen6x_mock.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace sen6x_sim {
+
+using esphome::i2c::ErrorCode;
+
+static const uint8_t MOCK_I2C_ADDRESS = 0x6B;
+
+// Model masks for the command table
+static const uint8_t MODELS_ALL = 0x3F;
+static const uint8_t MODELS_GAS = (1 << (uint8_t)MockModel::SEN65) |
+                                  (1 << (uint8_t)MockModel::SEN66) |
+                                  (1 << (uint8_t)MockModel::SEN68) |
+                                  (1 << (uint8_t)MockModel::SEN69C);
+static const uint8_t MODELS_CO2 = (1 << (uint8_t)MockModel::SEN63C) |
+                                  (1 << (uint8_t)MockModel::SEN66) |
+                                  (1 << (uint8_t)MockModel::SEN69C);
+
+static const uint8_t FLAG_IDLE_ONLY = 1 << 0;     // Rejected while measuring
+static const uint8_t FLAG_MEASURING_ONLY = 1 << 1; // Rejected in idle mode
+static const uint8_t FLAG_SET_IDLE_ONLY = 1 << 2;  // Only the setter is idle
+
+struct MockCommand {
+  uint16_t code;
+  uint8_t response_words; // Getter response (or setter response for FRC)
+  uint8_t payload_words;  // Setter payload (0 = no setter)
+  uint16_t execution_ms;
+  uint8_t flags;
+  uint8_t models;
+};
+
+// Datasheet v0.92 command overview. Measured-values reads are model-specific
+// and handled separately.
+static const MockCommand MOCK_COMMANDS[] = {
+    {0x0021, 0, 0, 50, FLAG_IDLE_ONLY, MODELS_ALL},       // Start measurement
+    {0x0104, 0, 0, 1000, 0, MODELS_ALL},                  // Stop measurement
+    {0x0202, 1, 0, 20, 0, MODELS_ALL},                    // Data ready
+    {0x0316, 5, 0, 20, FLAG_MEASURING_ONLY, MODELS_ALL},  // Number conc.
+    {0x60B2, 1, 4, 20, 0, MODELS_ALL},                    // Temperature offset
+    {0x6100, 0, 4, 20, FLAG_IDLE_ONLY, MODELS_ALL},       // RH/T acceleration
+    {0xD014, 16, 0, 20, 0, MODELS_ALL},                   // Product name
+    {0xD033, 16, 0, 20, 0, MODELS_ALL},                   // Serial number
+    {0xD100, 1, 0, 20, 0, MODELS_ALL},                    // Version
+    {0xD206, 2, 0, 20, 0, MODELS_ALL},                    // Device status
+    {0xD210, 2, 0, 20, 0, MODELS_ALL},                    // Read and clear
+    {0xD304, 0, 0, 1200, 0, MODELS_ALL},                  // Device reset
+    {0x5607, 0, 0, 20, FLAG_IDLE_ONLY, MODELS_ALL},       // Fan cleaning
+    {0x6765, 0, 0, 1300, FLAG_IDLE_ONLY, MODELS_ALL},     // SHT heater
+    {0x6790, 2, 0, 20, 0, MODELS_ALL},                    // Heater readback
+    {0x60D0, 6, 6, 20, FLAG_SET_IDLE_ONLY, MODELS_GAS},   // VOC tuning
+    {0x60E1, 6, 6, 20, FLAG_SET_IDLE_ONLY, MODELS_GAS},   // NOx tuning
+    {0x6181, 4, 4, 20, FLAG_SET_IDLE_ONLY, MODELS_GAS},   // VOC state
+    {0x6707, 1, 1, 500, FLAG_IDLE_ONLY, MODELS_CO2},      // Forced recal.
+    {0x6711, 1, 1, 20, FLAG_SET_IDLE_ONLY, MODELS_CO2},   // CO2 ASC
+    {0x6720, 1, 1, 20, 0, MODELS_CO2},                    // Ambient pressure
+    {0x6736, 1, 1, 20, FLAG_SET_IDLE_ONLY, MODELS_CO2},   // Sensor altitude
+    {0x6754, 0, 0, 1200, FLAG_IDLE_ONLY, MODELS_CO2},     // CO2 factory reset
+};
+
+struct MockModelInfo {
+  const char *name;
+  uint16_t read_command;
+  uint8_t frame_words;
+};
+
+static const MockModelInfo MOCK_MODELS[] = {
+    {"SEN62", 0x04A3, 6},  {"SEN63C", 0x0471, 7}, {"SEN65", 0x0446, 8},
+    {"SEN66", 0x0300, 9},  {"SEN68", 0x0467, 9},  {"SEN69C", 0x04B5, 10},
+};
+
+// Bitwise reference implementation (independent of the component's LUT)
+static uint8_t mock_crc(uint8_t msb, uint8_t lsb) {
+  uint8_t crc = 0xFF;
+  const uint8_t bytes[2] = {msb, lsb};
+  for (uint8_t byte : bytes) {
+    crc ^= byte;
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+  }
+  return crc;
+}
+
+const char *mock_model_name(MockModel model) {
+  if (model >= MockModel::COUNT)
+    return "?";
+  return MOCK_MODELS[(uint8_t)model].name;
+}
+
+Sen6xMock::Sen6xMock(MockModel model, uint32_t seed)
+    : model_(model), random_(seed), serial_(0x1234ABCDu ^ seed) {}
+
+// Start + address + bytes (9 clocks each with ACK) + stop
+void Sen6xMock::transfer_time_(size_t bytes) {
+  uint64_t bits = (uint64_t)(bytes + 1) * 9 + 2;
+  uint64_t us = bits * 1000000 / this->faults_.bus_frequency_hz +
+                this->faults_.latency_us;
+  advance_clock_us(us);
+  this->stats_.bus_time_us += us;
+}
+
+bool Sen6xMock::busy_() const {
+  return this->faults_.enforce_execution_time &&
+         clock_us() < this->busy_until_us_;
+}
+
+// Samples completed since Start Measurement (sensor clock, 1 s nominal)
+uint32_t Sen6xMock::sample_index_() const {
+  if (!this->measuring_)
+    return 0;
+  double period_us = 1000000.0 * (1.0 + this->faults_.clock_error);
+  return (uint32_t)((clock_us() - this->measurement_start_us_) / period_us);
+}
+
+void Sen6xMock::plug_in() {
+  this->detached_ = false;
+  this->measuring_ = false;
+  this->response_len_ = 0;
+  this->busy_until_us_ = 0;
+  this->heater_done_us_ = 0;
+  this->reset_settings_();
+}
+
+// Power-on defaults; the command counters are kept for the checks
+void Sen6xMock::reset_settings_() {
+  this->settings_.altitude_m = 0;
+  this->settings_.ambient_pressure_hpa = 1013;
+  this->settings_.temperature_offset = 0;
+  this->settings_.co2_asc = true;
+  this->settings_.voc_state[0] = 0;
+  this->settings_.voc_state[1] = 0;
+}
+
+ErrorCode Sen6xMock::write(uint8_t address, const uint8_t *data, size_t len,
+                           bool stop) {
+  this->transfer_time_(len);
+  if (address != MOCK_I2C_ADDRESS)
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  if (this->detached_) {
+    this->stats_.detached_nacks++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  this->stats_.writes++;
+  this->stats_.bytes_written += len;
+  this->response_len_ = 0;
+
+  if (this->busy_()) {
+    this->stats_.busy_nacks++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  if (this->random_.chance(this->faults_.write_nack_rate)) {
+    this->stats_.injected_nacks++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  if (len < 2 || (len - 2) % 3 != 0) {
+    this->stats_.malformed_writes++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+
+  uint16_t command = ((uint16_t)data[0] << 8) | data[1];
+  uint8_t payload_words = (len - 2) / 3;
+  uint16_t payload[6];
+  if (payload_words > 6) {
+    this->stats_.malformed_writes++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  for (uint8_t i = 0; i < payload_words; i++) {
+    const uint8_t *word = &data[2 + i * 3];
+    if (mock_crc(word[0], word[1]) != word[2]) {
+      this->stats_.bad_request_crc++;
+      return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+    }
+    payload[i] = ((uint16_t)word[0] << 8) | word[1];
+  }
+
+  if (!this->handle_command_(command, payload, payload_words))
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  return esphome::i2c::ERROR_OK;
+}
+
+ErrorCode Sen6xMock::read(uint8_t address, uint8_t *data, size_t len) {
+  this->transfer_time_(len);
+  if (address != MOCK_I2C_ADDRESS)
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  if (this->detached_) {
+    this->stats_.detached_nacks++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  this->stats_.reads++;
+  this->stats_.bytes_read += len;
+
+  if (this->busy_()) {
+    this->stats_.busy_nacks++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  if (this->response_len_ == 0) {
+    this->stats_.unexpected_reads++;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+  if (this->random_.chance(this->faults_.read_nack_rate)) {
+    this->stats_.injected_nacks++;
+    this->response_len_ = 0;
+    return esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+  }
+
+  // Reading past the response clocks in 0xFF (SDA released)
+  for (size_t i = 0; i < len; i++)
+    data[i] = i < this->response_len_ ? this->response_[i] : 0xFF;
+  for (size_t crc = 2; crc < len && crc < this->response_len_; crc += 3) {
+    if (this->random_.chance(this->faults_.crc_error_rate)) {
+      data[crc] ^= 0x5A;
+      this->stats_.injected_crc_errors++;
+    }
+  }
+  this->response_len_ = 0;
+  return esphome::i2c::ERROR_OK;
+}
+
+void Sen6xMock::respond_(const uint16_t *words, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t *out = &this->response_[i * 3];
+    out[0] = words[i] >> 8;
+    out[1] = words[i] & 0xFF;
+    out[2] = mock_crc(out[0], out[1]);
+  }
+  this->response_len_ = count * 3;
+}
+
+// 32-byte zero padded string response
+void Sen6xMock::respond_string_(const char *text) {
+  uint16_t words[16] = {0};
+  size_t len = std::strlen(text);
+  for (size_t i = 0; i < len && i < 32; i++) {
+    if (i % 2 == 0)
+      words[i / 2] |= (uint16_t)(uint8_t)text[i] << 8;
+    else
+      words[i / 2] |= (uint8_t)text[i];
+  }
+  this->respond_(words, 16);
+}
+
+static uint16_t scaled(float value, float scale) {
+  return (uint16_t)(int16_t)std::lround(value * scale);
+}
+
+// Slowly varying indoor air with sensor noise; warm-up values follow the
+// datasheet sentinels (0x7FFF int16, 0xFFFF uint16)
+void Sen6xMock::fill_frame_(uint32_t sample, uint16_t *words) {
+  float k = (float)sample;
+  float noise = this->random_.uniform() - 0.5f;
+  float pm1 = 6.0f + 2.0f * std::sin(k / 90.0f) + 0.4f * noise;
+  float pm25 = pm1 * 1.3f;
+  float pm4 = pm25 * 1.1f;
+  float pm10 = pm4 * 1.05f;
+  words[0] = scaled(pm1, 10.0f);
+  words[1] = scaled(pm25, 10.0f);
+  words[2] = scaled(pm4, 10.0f);
+  words[3] = scaled(pm10, 10.0f);
+  words[4] = scaled(45.0f + 5.0f * std::sin(k / 600.0f) + 0.1f * noise, 100.0f);
+  words[5] = scaled(22.0f + std::sin(k / 900.0f) + 0.02f * noise, 200.0f);
+
+  uint16_t voc = scaled(100.0f + 20.0f * std::sin(k / 300.0f) + noise, 10.0f);
+  uint16_t nox = sample < 10 ? 0x7FFF : scaled(1.0f + 0.2f * noise, 10.0f);
+  uint16_t co2 = sample < 5 ? 0xFFFF
+                            : (uint16_t)std::lround(
+                                  600.0f + 150.0f * std::sin(k / 1200.0f) +
+                                  5.0f * noise);
+  uint16_t hcho = sample < 10 ? 0xFFFF
+                              : scaled(15.0f + 3.0f * std::sin(k / 700.0f) +
+                                           0.5f * noise,
+                                       10.0f);
+
+  switch (this->model_) {
+  case MockModel::SEN63C:
+    words[6] = co2;
+    break;
+  case MockModel::SEN65:
+    words[6] = voc;
+    words[7] = nox;
+    break;
+  case MockModel::SEN66:
+    words[6] = voc;
+    words[7] = nox;
+    words[8] = co2;
+    break;
+  case MockModel::SEN68:
+    words[6] = voc;
+    words[7] = nox;
+    words[8] = hcho;
+    break;
+  case MockModel::SEN69C:
+    words[6] = voc;
+    words[7] = nox;
+    words[8] = hcho;
+    words[9] = co2;
+    break;
+  default:
+    break;
+  }
+}
+
+bool Sen6xMock::handle_command_(uint16_t command, const uint16_t *payload,
+                                uint8_t payload_words) {
+  const MockModelInfo &info = MOCK_MODELS[(uint8_t)this->model_];
+  uint64_t now = clock_us();
+
+  // Measured values: only the model's own read command exists
+  if (command == info.read_command) {
+    if (payload_words != 0) {
+      this->stats_.malformed_writes++;
+      return false;
+    }
+    if (!this->measuring_) {
+      this->stats_.wrong_mode_commands++;
+      return false;
+    }
+    uint16_t frame[10];
+    uint32_t sample = this->sample_index_();
+    this->fill_frame_(sample, frame);
+    this->last_sample_read_ = sample;
+    this->respond_(frame, info.frame_words);
+    this->stats_.frames_read++;
+    this->busy_until_us_ = now + 20000;
+    return true;
+  }
+
+  const MockCommand *entry = nullptr;
+  for (const MockCommand &candidate : MOCK_COMMANDS) {
+    if (candidate.code == command) {
+      entry = &candidate;
+      break;
+    }
+  }
+  if (entry == nullptr ||
+      (entry->models & (1 << (uint8_t)this->model_)) == 0) {
+    this->stats_.unsupported_commands++;
+    return false;
+  }
+  bool is_set = payload_words > 0;
+  if ((is_set && payload_words != entry->payload_words) ||
+      (!is_set && entry->response_words == 0 && entry->payload_words > 0)) {
+    this->stats_.malformed_writes++;
+    return false;
+  }
+  if (((entry->flags & FLAG_IDLE_ONLY) && this->measuring_) ||
+      ((entry->flags & FLAG_SET_IDLE_ONLY) && is_set && this->measuring_) ||
+      ((entry->flags & FLAG_MEASURING_ONLY) && !this->measuring_)) {
+    this->stats_.wrong_mode_commands++;
+    return false;
+  }
+
+  uint16_t words[16] = {0};
+  switch (command) {
+  case 0x0021:
+    // Datasheet: wait at least 20 s after the heater before starting
+    if (this->settings_.heater_activations > 0 &&
+        now < this->heater_activated_us_ + 20000000ULL)
+      this->stats_.early_starts++;
+    // SEN63C/SEN69C: >= 24 s between two starts (CO2 sensor restart)
+    if ((this->model_ == MockModel::SEN63C ||
+         this->model_ == MockModel::SEN69C) &&
+        this->started_ && now < this->measurement_start_us_ + 24000000ULL)
+      this->stats_.early_starts++;
+    this->started_ = true;
+    this->measuring_ = true;
+    this->measurement_start_us_ = now;
+    this->last_sample_read_ = 0;
+    break;
+  case 0x0104:
+    this->measuring_ = false;
+    break;
+  case 0x0202:
+    words[0] = this->sample_index_() > this->last_sample_read_ ? 0x0001 : 0;
+    this->respond_(words, 1);
+    break;
+  case 0x0316: {
+    float k = (float)this->sample_index_();
+    float nc05 = 40.0f + 10.0f * std::sin(k / 90.0f);
+    const float ratios[5] = {1.0f, 1.15f, 1.18f, 1.19f, 1.2f};
+    for (uint8_t i = 0; i < 5; i++)
+      words[i] = scaled(nc05 * ratios[i], 10.0f);
+    this->respond_(words, 5);
+    break;
+  }
+  case 0x60B2:
+    if (is_set) {
+      this->settings_.temperature_offset = (int16_t)payload[0];
+    } else {
+      words[0] = (uint16_t)this->settings_.temperature_offset;
+      this->respond_(words, 1);
+    }
+    break;
+  case 0x6100:
+    this->settings_.rht_acceleration_writes++;
+    break;
+  case 0xD014:
+    this->respond_string_(info.name);
+    break;
+  case 0xD033: {
+    char serial[32];
+    std::snprintf(serial, sizeof(serial), "SIM%s%08X", info.name + 3,
+                  (unsigned int)this->serial_);
+    this->respond_string_(serial);
+    break;
+  }
+  case 0xD100:
+    words[0] = 0x0400; // Firmware 4.0
+    this->respond_(words, 1);
+    break;
+  case 0xD206:
+  case 0xD210:
+    words[0] = this->device_status_ >> 16;
+    words[1] = this->device_status_ & 0xFFFF;
+    this->respond_(words, 2);
+    if (command == 0xD210)
+      this->device_status_ = 0;
+    break;
+  case 0xD304:
+    // Comes back idle with its volatile settings lost
+    this->measuring_ = false;
+    this->settings_.device_resets++;
+    this->reset_settings_();
+    break;
+  case 0x5607:
+    this->settings_.fan_cleanings++;
+    break;
+  case 0x6765:
+    this->settings_.heater_activations++;
+    this->heater_activated_us_ = now;
+    this->heater_done_us_ = now + (uint64_t)entry->execution_ms * 1000;
+    break;
+  case 0x6790: {
+    bool done = this->settings_.heater_activations > 0 &&
+                now >= this->heater_done_us_;
+    words[0] = done ? scaled(30.0f, 100.0f) : 0x7FFF;
+    words[1] = done ? scaled(45.0f, 200.0f) : 0x7FFF;
+    this->respond_(words, 2);
+    break;
+  }
+  case 0x60D0:
+  case 0x60E1:
+    if (is_set) {
+      if (command == 0x60D0)
+        this->settings_.voc_tuning_writes++;
+      else
+        this->settings_.nox_tuning_writes++;
+    } else {
+      const uint16_t defaults[6] = {100, 12, 12, 180, 50, 230};
+      this->respond_(defaults, 6);
+    }
+    break;
+  case 0x6181:
+    if (is_set) {
+      this->settings_.voc_state[0] = ((uint32_t)payload[0] << 16) | payload[1];
+      this->settings_.voc_state[1] = ((uint32_t)payload[2] << 16) | payload[3];
+    } else {
+      // The algorithm state drifts while measuring
+      uint32_t drift = this->sample_index_();
+      words[0] = (this->settings_.voc_state[0] + drift) >> 16;
+      words[1] = (this->settings_.voc_state[0] + drift) & 0xFFFF;
+      words[2] = (this->settings_.voc_state[1] + drift) >> 16;
+      words[3] = (this->settings_.voc_state[1] + drift) & 0xFFFF;
+      this->respond_(words, 4);
+    }
+    break;
+  case 0x6707:
+    this->settings_.forced_recalibrations++;
+    words[0] = 0x8000; // Correction 0 ppm
+    this->respond_(words, 1);
+    break;
+  case 0x6711:
+    if (is_set) {
+      this->settings_.co2_asc = payload[0] != 0;
+    } else {
+      words[0] = this->settings_.co2_asc ? 1 : 0;
+      this->respond_(words, 1);
+    }
+    break;
+  case 0x6720:
+    if (is_set) {
+      this->settings_.ambient_pressure_hpa = payload[0];
+    } else {
+      words[0] = this->settings_.ambient_pressure_hpa;
+      this->respond_(words, 1);
+    }
+    break;
+  case 0x6736:
+    if (is_set) {
+      this->settings_.altitude_m = (int16_t)payload[0];
+    } else {
+      words[0] = (uint16_t)this->settings_.altitude_m;
+      this->respond_(words, 1);
+    }
+    break;
+  default:
+    break;
+  }
+  this->busy_until_us_ = now + (uint64_t)entry->execution_ms * 1000;
+  return true;
+}
+
+} // namespace sen6x_sim
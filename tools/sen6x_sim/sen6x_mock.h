@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - simulated sensor
+// Answers the SEN6x I2C command set (datasheet v0.92) for all six models with
+// CRC-protected responses, on the simulated clock. Execution times are
+// enforced (the sensor NACKs while busy), idle-only commands are rejected in
+// measurement mode, and latency, NACKs and CRC errors can be injected.
+// Written from the datasheet, independently of the component's own tables.
+
+#pragma once
+
+#include "esphome/components/i2c/i2c.h"
+#include "sim_runtime.h"
+#include <cstdint>
+
+namespace sen6x_sim {
+
+enum class MockModel : uint8_t {
+  SEN62 = 0,
+  SEN63C,
+  SEN65,
+  SEN66,
+  SEN68,
+  SEN69C,
+  COUNT,
+};
+
+const char *mock_model_name(MockModel model);
+
+struct MockFaults {
+  float write_nack_rate{0.0f}; // Header/command NACK per write
+  float read_nack_rate{0.0f};  // NACK per read
+  float crc_error_rate{0.0f};  // Corrupted CRC per response word
+  uint32_t latency_us{0};      // Extra time per transfer (mux, stretching)
+  uint32_t bus_frequency_hz{100000};
+  float clock_error{0.0f}; // Sensor oscillator error (0.01 = 1% slow)
+  bool enforce_execution_time{true};
+};
+
+struct MockStats {
+  uint32_t writes;
+  uint32_t reads;
+  uint32_t bytes_written;
+  uint32_t bytes_read;
+  uint64_t bus_time_us; // Transfer time incl. injected latency
+  uint32_t frames_read; // Measured-values frames served
+  uint32_t injected_nacks;
+  uint32_t injected_crc_errors;
+  uint32_t busy_nacks;         // Accessed before the execution time elapsed
+  uint32_t unsupported_commands; // Unknown or not available on the model
+  uint32_t wrong_mode_commands;  // Idle-only while measuring or vice versa
+  uint32_t malformed_writes;     // Truncated word or wrong payload length
+  uint32_t bad_request_crc;    // Payload word with a wrong CRC
+  uint32_t unexpected_reads;   // Read without a pending response
+  uint32_t detached_nacks;     // Transfers while unplugged
+  uint32_t early_starts;       // Start < 20 s after the SHT heater, or < 24 s
+                               // after the previous start on SEN63C/SEN69C
+};
+
+// Every configuration setter of the sensor (written values, for checks)
+struct MockSettings {
+  int16_t altitude_m{0};
+  uint16_t ambient_pressure_hpa{1013};
+  int16_t temperature_offset{0}; // Scaled x200
+  bool co2_asc{true};
+  uint32_t voc_state[2]{0, 0};
+  uint16_t voc_tuning_writes{0};
+  uint16_t nox_tuning_writes{0};
+  uint16_t rht_acceleration_writes{0};
+  uint16_t fan_cleanings{0};
+  uint16_t heater_activations{0};
+  uint16_t device_resets{0};
+  uint16_t forced_recalibrations{0};
+};
+
+class Sen6xMock : public esphome::i2c::I2CBus {
+public:
+  explicit Sen6xMock(MockModel model, uint32_t seed = 1);
+
+  esphome::i2c::ErrorCode read(uint8_t address, uint8_t *data,
+                               size_t len) override;
+  esphome::i2c::ErrorCode write(uint8_t address, const uint8_t *data,
+                                size_t len, bool stop) override;
+
+  MockModel get_model() const { return this->model_; }
+  MockFaults &faults() { return this->faults_; }
+  const MockStats &stats() const { return this->stats_; }
+  const MockSettings &settings() const { return this->settings_; }
+  void reset_stats() { this->stats_ = MockStats{}; }
+  bool is_measuring() const { return this->measuring_; }
+  // Device status register (e.g. SEN6X_STATUS_* bits to simulate errors)
+  void set_device_status(uint32_t status) { this->device_status_ = status; }
+  // Disconnects the sensor (every transfer NACKs) until plug_in(), which
+  // powers it up again: idle, volatile settings back at their defaults
+  void unplug() { this->detached_ = true; }
+  void plug_in();
+  bool is_detached() const { return this->detached_; }
+
+protected:
+  void transfer_time_(size_t bytes);
+  bool busy_() const;
+  uint32_t sample_index_() const;
+  // Returns false (NACK) after counting the reason in stats_
+  bool handle_command_(uint16_t command, const uint16_t *payload,
+                       uint8_t payload_words);
+  void respond_(const uint16_t *words, uint8_t count);
+  void respond_string_(const char *text);
+  void reset_settings_();
+  void fill_frame_(uint32_t sample, uint16_t *words);
+
+  MockModel model_;
+  SimRandom random_;
+  uint32_t serial_;
+  MockFaults faults_;
+  MockStats stats_{};
+  MockSettings settings_;
+  uint32_t device_status_{0};
+  bool detached_{false};
+  bool measuring_{false};
+  uint64_t measurement_start_us_{0};
+  bool started_{false};
+  uint32_t last_sample_read_{0};
+  uint64_t busy_until_us_{0};
+  uint64_t heater_done_us_{0};
+  uint64_t heater_activated_us_{0};
+
+  // Pending response (bytes on the wire, CRC included)
+  uint8_t response_[48];
+  uint8_t response_len_{0};
+};
+
+} // namespace sen6x_sim
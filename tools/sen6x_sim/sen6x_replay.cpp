@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - capture replay
+// Feeds SEN6XCAP records (Sen6xComponent::dump_capture(), see
+// components/sen6x/sen6x_capture.h) back through the component's decoder and
+// prints every publish as CSV. Input is a device log or the output of
+// --generate; any text in front of "SEN6XCAP" on a line is ignored.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/sen6x_sim -Icomponents/sen6x
+//       tools/sen6x_sim/sim_runtime.cpp tools/sen6x_sim/sen6x_mock.cpp
+//       tools/sen6x_sim/sen6x_replay.cpp components/sen6x/sen6x.cpp
+//       -o sen6x_replay
+//   ./sen6x_replay --generate SEN66 120 > trace.log
+//   ./sen6x_replay trace.log
+//
+// The component boots against a simulated sensor of the model the trace was
+// recorded from (first frame command), polling is then stopped and each
+// record is replayed at its recorded time offset.
+
+#include "sen6x.h"
+#include "sen6x_bus_scheduler.h"
+#include "sen6x_mock.h"
+#include "sim_runtime.h"
+#include "esphome/core/log.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using esphome::sen6x::Sen6xComponent;
+using namespace sen6x_sim;
+
+namespace {
+
+struct CaptureRecord {
+  uint32_t timestamp_ms;
+  uint16_t command;
+  std::vector<uint16_t> words;
+};
+
+const struct {
+  uint16_t command;
+  MockModel model;
+} FRAME_COMMANDS[] = {
+    {esphome::sen6x::SEN6X_CMD_READ_SEN62, MockModel::SEN62},
+    {esphome::sen6x::SEN6X_CMD_READ_SEN63C, MockModel::SEN63C},
+    {esphome::sen6x::SEN6X_CMD_READ_SEN65, MockModel::SEN65},
+    {esphome::sen6x::SEN6X_CMD_READ_SEN66, MockModel::SEN66},
+    {esphome::sen6x::SEN6X_CMD_READ_SEN68, MockModel::SEN68},
+    {esphome::sen6x::SEN6X_CMD_READ_SEN69C, MockModel::SEN69C},
+};
+
+// "... SEN6XCAP <timestamp> <command> <word>..." (BEGIN/END lines skipped)
+bool parse_record(const char *line, CaptureRecord *record) {
+  const char *start = std::strstr(line, "SEN6XCAP ");
+  if (start == nullptr)
+    return false;
+  char *cursor = const_cast<char *>(start) + 9;
+  char *end;
+  record->timestamp_ms = std::strtoul(cursor, &end, 10);
+  if (end == cursor)
+    return false;
+  cursor = end;
+  record->command = std::strtoul(cursor, &end, 16);
+  if (end == cursor)
+    return false;
+  record->words.clear();
+  while (true) {
+    cursor = end;
+    unsigned long word = std::strtoul(cursor, &end, 16);
+    if (end == cursor || word > 0xFFFF)
+      break;
+    record->words.push_back(word);
+  }
+  return true;
+}
+
+std::vector<CaptureRecord> read_records(FILE *input) {
+  std::vector<CaptureRecord> records;
+  char line[512];
+  CaptureRecord record;
+  while (std::fgets(line, sizeof(line), input) != nullptr) {
+    if (parse_record(line, &record))
+      records.push_back(record);
+  }
+  return records;
+}
+
+bool parse_model(const char *name, MockModel *model) {
+  for (uint8_t i = 0; i < (uint8_t)MockModel::COUNT; i++) {
+    if (strcasecmp(name, mock_model_name((MockModel)i)) == 0) {
+      *model = (MockModel)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// One entity per decoded channel and status flag; publishes go to 'output'
+struct ReplayEntities {
+  std::vector<std::unique_ptr<esphome::sensor::Sensor>> sensors;
+  std::vector<std::unique_ptr<esphome::binary_sensor::BinarySensor>>
+      binary_sensors;
+  const uint32_t *timestamp_ms{nullptr};
+  FILE *output{nullptr};
+
+  esphome::sensor::Sensor *sensor(const char *name) {
+    auto sens = std::make_unique<esphome::sensor::Sensor>(name);
+    esphome::sensor::Sensor *raw = sens.get();
+    raw->add_on_state_callback([this, raw](float value) {
+      if (this->output != nullptr)
+        std::fprintf(this->output, "%u,%s,%g\n", (unsigned int)*timestamp_ms,
+                     raw->get_name().c_str(), value);
+    });
+    this->sensors.push_back(std::move(sens));
+    return raw;
+  }
+  esphome::binary_sensor::BinarySensor *binary_sensor(const char *name) {
+    auto sens = std::make_unique<esphome::binary_sensor::BinarySensor>(name);
+    esphome::binary_sensor::BinarySensor *raw = sens.get();
+    raw->add_on_state_callback([this, raw](bool value) {
+      if (this->output != nullptr)
+        std::fprintf(this->output, "%u,%s,%d\n", (unsigned int)*timestamp_ms,
+                     raw->get_name().c_str(), value ? 1 : 0);
+    });
+    this->binary_sensors.push_back(std::move(sens));
+    return raw;
+  }
+};
+
+void configure_entities(Sen6xComponent &component, ReplayEntities &entities) {
+  component.set_pm_1_0_sensor(entities.sensor("PM1.0"));
+  component.set_pm_2_5_sensor(entities.sensor("PM2.5"));
+  component.set_pm_4_0_sensor(entities.sensor("PM4.0"));
+  component.set_pm_10_0_sensor(entities.sensor("PM10.0"));
+  component.set_humidity_sensor(entities.sensor("Humidity"));
+  component.set_temperature_sensor(entities.sensor("Temperature"));
+  component.set_voc_index_sensor(entities.sensor("VOC Index"));
+  component.set_nox_index_sensor(entities.sensor("NOx Index"));
+  component.set_co2_sensor(entities.sensor("CO2"));
+  component.set_formaldehyde_sensor(entities.sensor("Formaldehyde"));
+  component.set_tvoc_well_sensor(entities.sensor("TVOC WELL"));
+  component.set_tvoc_reset_sensor(entities.sensor("TVOC RESET"));
+  component.set_tvoc_ethanol_sensor(entities.sensor("TVOC Ethanol"));
+  component.set_nc_0_5_sensor(entities.sensor("NC0.5"));
+  component.set_nc_1_0_sensor(entities.sensor("NC1.0"));
+  component.set_nc_2_5_sensor(entities.sensor("NC2.5"));
+  component.set_nc_4_0_sensor(entities.sensor("NC4.0"));
+  component.set_nc_10_0_sensor(entities.sensor("NC10.0"));
+  component.set_fan_error_binary_sensor(entities.binary_sensor("Fan Error"));
+  component.set_gas_error_binary_sensor(entities.binary_sensor("Gas Error"));
+  component.set_rht_error_binary_sensor(entities.binary_sensor("RHT Error"));
+  component.set_pm_error_binary_sensor(entities.binary_sensor("PM Error"));
+}
+
+// Boots a fresh component against the simulated sensor
+bool boot(SimApp &app, Sen6xComponent &component, Sen6xMock &mock,
+          uint32_t update_interval_ms) {
+  reset_clock();
+  preferences().clear();
+  esphome::sen6x::global_sen6x_bus_scheduler =
+      esphome::sen6x::Sen6xBusScheduler();
+  component.set_i2c_bus(&mock);
+  component.set_i2c_address(0x6B);
+  component.set_update_interval(update_interval_ms);
+  bool ready = false;
+  component.add_on_ready_callback([&]() { ready = true; });
+  app.register_component(&component);
+  app.register_component(&esphome::sen6x::global_sen6x_bus_scheduler);
+  app.setup();
+  return app.run_until([&]() { return ready; }, 30000);
+}
+
+// Records 'seconds' of simulated operation and prints the capture dump
+int generate(MockModel model, uint32_t seconds, uint32_t update_interval_ms) {
+  SimApp app;
+  Sen6xComponent component;
+  ReplayEntities entities;
+  Sen6xMock mock(model, 1);
+  configure_entities(component, entities);
+  component.set_capture_buffer_size(32768);
+  if (!boot(app, component, mock, update_interval_ms)) {
+    std::fprintf(stderr, "Boot did not complete within 30 s\n");
+    return 1;
+  }
+  app.run_for(seconds * 1000);
+
+  set_log_level(ESPHOME_LOG_LEVEL_INFO);
+  set_log_sink([](int level, const char *tag, const char *message) {
+    if (std::strncmp(message, "SEN6XCAP", 8) == 0)
+      std::printf("%s\n", message);
+  });
+  component.dump_capture();
+  set_log_sink(nullptr);
+  app.shutdown();
+  return 0;
+}
+
+int replay(FILE *input, uint32_t update_interval_ms) {
+  std::vector<CaptureRecord> records = read_records(input);
+  if (records.empty()) {
+    std::fprintf(stderr, "No SEN6XCAP records found\n");
+    return 1;
+  }
+
+  // The frame command identifies the model the trace was recorded from
+  MockModel model = MockModel::SEN66;
+  bool found = false;
+  for (const CaptureRecord &record : records) {
+    for (const auto &entry : FRAME_COMMANDS) {
+      if (entry.command == record.command) {
+        model = entry.model;
+        found = true;
+        break;
+      }
+    }
+    if (found)
+      break;
+  }
+  if (!found)
+    std::fprintf(stderr, "No measurement frame in trace, assuming SEN66\n");
+
+  SimApp app;
+  Sen6xComponent component;
+  ReplayEntities entities;
+  Sen6xMock mock(model, 1);
+  uint32_t timestamp_ms = 0;
+  entities.timestamp_ms = &timestamp_ms;
+  configure_entities(component, entities);
+  if (!boot(app, component, mock, update_interval_ms)) {
+    std::fprintf(stderr, "Boot did not complete within 30 s\n");
+    return 1;
+  }
+  // Only replayed records publish from here on
+  component.stop_poller();
+  app.run_for(1000);
+  entities.output = stdout;
+
+  std::printf("timestamp_ms,sensor,value\n");
+  uint64_t decode_ns = 0;
+  uint64_t max_decode_ns = 0;
+  uint32_t start_ms = records.front().timestamp_ms;
+  uint32_t elapsed_ms = 0;
+  for (const CaptureRecord &record : records) {
+    // Keep the recorded spacing so time-based filters behave as on device
+    uint32_t offset_ms = record.timestamp_ms - start_ms;
+    if (offset_ms > elapsed_ms) {
+      app.run_for(offset_ms - elapsed_ms);
+      elapsed_ms = offset_ms;
+    }
+    timestamp_ms = record.timestamp_ms;
+    auto start = std::chrono::steady_clock::now();
+    component.replay_response(record.command, record.words.data(),
+                              record.words.size());
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+    decode_ns += ns;
+    if (ns > max_decode_ns)
+      max_decode_ns = ns;
+  }
+  app.shutdown();
+
+  std::fprintf(stderr, "%s: %u records over %u s, decode %.2f us avg, %.2f "
+                       "us max\n",
+               mock_model_name(model), (unsigned int)records.size(),
+               (unsigned int)(elapsed_ms / 1000),
+               decode_ns / 1000.0 / records.size(), max_decode_ns / 1000.0);
+  return 0;
+}
+
+void usage(const char *program) {
+  std::printf("Usage: %s [options] [FILE]   replay FILE (default stdin)\n"
+              "       %s [options] --generate MODEL SECONDS\n"
+              "  --interval MS      update_interval (10000)\n"
+              "  --log-level N      component log level, 0-7 (2 = WARN)\n",
+              program, program);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t update_interval_ms = 10000;
+  const char *path = nullptr;
+  const char *generate_model = nullptr;
+  uint32_t generate_seconds = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (std::strcmp(arg, "--help") == 0) {
+      usage(argv[0]);
+      return 0;
+    }
+    if (arg[0] != '-') {
+      path = arg;
+      continue;
+    }
+    if (value == nullptr) {
+      usage(argv[0]);
+      return 2;
+    }
+    i++;
+    if (std::strcmp(arg, "--generate") == 0 && i + 1 < argc) {
+      generate_model = value;
+      generate_seconds = std::strtoul(argv[++i], nullptr, 10);
+    } else if (std::strcmp(arg, "--interval") == 0) {
+      update_interval_ms = std::strtoul(value, nullptr, 10);
+    } else if (std::strcmp(arg, "--log-level") == 0) {
+      set_log_level(std::atoi(value));
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if (generate_model != nullptr) {
+    MockModel model;
+    if (!parse_model(generate_model, &model)) {
+      std::fprintf(stderr, "Unknown model '%s'\n", generate_model);
+      return 2;
+    }
+    return generate(model, generate_seconds, update_interval_ms);
+  }
+
+  FILE *input = stdin;
+  if (path != nullptr) {
+    input = std::fopen(path, "r");
+    if (input == nullptr) {
+      std::fprintf(stderr, "Cannot open '%s'\n", path);
+      return 2;
+    }
+  }
+  int result = replay(input, update_interval_ms);
+  if (input != stdin)
+    std::fclose(input);
+  return result;
+}
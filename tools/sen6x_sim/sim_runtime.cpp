@@ -0,0 +1,340 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - runtime (see sim_runtime.h)
+
+#include "sim_runtime.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace sen6x_sim {
+
+static uint64_t now_us_ = 0;         // NOLINT
+static int log_level_ = ESPHOME_LOG_LEVEL_WARN; // NOLINT
+static LogSink log_sink_;                        // NOLINT
+
+uint64_t clock_us() { return now_us_; }
+void advance_clock_us(uint64_t us) { now_us_ += us; }
+void reset_clock() { now_us_ = 0; }
+void set_log_level(int level) { log_level_ = level; }
+void set_log_sink(LogSink sink) { log_sink_ = std::move(sink); }
+
+static uint64_t host_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// ========== SCHEDULER ==========
+
+struct SchedulerItem {
+  esphome::Component *component;
+  std::string name; // Empty = anonymous (never replaced or cancelled)
+  bool is_interval;
+  uint32_t interval_ms;
+  uint64_t due_us;
+  uint64_t sequence; // FIFO order between items due at the same time
+  bool removed;
+  std::function<void()> callback;
+};
+
+static std::vector<std::unique_ptr<SchedulerItem>> scheduler_items_; // NOLINT
+static uint64_t scheduler_sequence_ = 0;                             // NOLINT
+
+static bool scheduler_cancel(esphome::Component *component,
+                             const std::string &name, bool is_interval) {
+  bool found = false;
+  for (auto &item : scheduler_items_) {
+    if (!item->removed && item->component == component &&
+        item->is_interval == is_interval && item->name == name) {
+      item->removed = true;
+      found = true;
+    }
+  }
+  return found;
+}
+
+static void scheduler_add(esphome::Component *component,
+                          const std::string &name, bool is_interval,
+                          uint32_t delay_ms, std::function<void()> &&f,
+                          uint32_t first_delay_ms) {
+  if (!name.empty())
+    scheduler_cancel(component, name, is_interval);
+  auto item = std::make_unique<SchedulerItem>();
+  item->component = component;
+  item->name = name;
+  item->is_interval = is_interval;
+  item->interval_ms = delay_ms;
+  item->due_us = now_us_ + (uint64_t)first_delay_ms * 1000;
+  item->sequence = scheduler_sequence_++;
+  item->removed = false;
+  item->callback = std::move(f);
+  scheduler_items_.push_back(std::move(item));
+}
+
+// Runs every item due at the current time, including items that callbacks
+// schedule with a zero delay
+static void scheduler_run() {
+  while (true) {
+    SchedulerItem *next = nullptr;
+    for (auto &item : scheduler_items_) {
+      if (item->removed || item->due_us > now_us_)
+        continue;
+      if (next == nullptr || item->due_us < next->due_us ||
+          (item->due_us == next->due_us && item->sequence < next->sequence))
+        next = item.get();
+    }
+    if (next == nullptr)
+      break;
+
+    if (next->component != nullptr && next->component->is_failed()) {
+      next->removed = true;
+      continue;
+    }
+    if (next->is_interval) {
+      next->due_us += (uint64_t)std::max<uint32_t>(next->interval_ms, 1) * 1000;
+      if (next->due_us <= now_us_)
+        next->due_us = now_us_ + (uint64_t)next->interval_ms * 1000;
+      next->sequence = scheduler_sequence_++;
+    } else {
+      next->removed = true;
+    }
+    // The callback may add items (reallocating the vector) or cancel this one
+    std::function<void()> callback = next->callback;
+    callback();
+  }
+  scheduler_items_.erase(
+      std::remove_if(scheduler_items_.begin(), scheduler_items_.end(),
+                     [](const std::unique_ptr<SchedulerItem> &item) {
+                       return item->removed;
+                     }),
+      scheduler_items_.end());
+}
+
+static void scheduler_clear() { scheduler_items_.clear(); }
+
+// ========== PREFERENCES ==========
+
+static SimPreferences preferences_; // NOLINT
+
+SimPreferences &preferences() { return preferences_; }
+
+esphome::ESPPreferenceObject
+SimPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
+  this->slots_.push_back(std::make_unique<Slot>(this, type));
+  return esphome::ESPPreferenceObject(this->slots_.back().get());
+}
+
+bool SimPreferences::sync() {
+  this->sync_count_++;
+  return true;
+}
+
+void SimPreferences::clear() {
+  this->records_.clear();
+  this->save_count_ = 0;
+  this->sync_count_ = 0;
+}
+
+bool SimPreferences::Slot::save(const uint8_t *data, size_t len) {
+  this->parent_->records_[this->type_].assign(data, data + len);
+  this->parent_->save_count_++;
+  return true;
+}
+
+bool SimPreferences::Slot::load(uint8_t *data, size_t len) {
+  auto it = this->parent_->records_.find(this->type_);
+  if (it == this->parent_->records_.end() || it->second.size() != len)
+    return false;
+  std::memcpy(data, it->second.data(), len);
+  return true;
+}
+
+// ========== MAIN LOOP ==========
+
+SimApp::SimApp() {
+  scheduler_clear();
+  esphome::global_preferences = &preferences_;
+  this->next_loop_us_ = now_us_;
+}
+
+SimApp::~SimApp() { scheduler_clear(); }
+
+void SimApp::register_component(esphome::Component *component) {
+  this->components_.push_back(component);
+}
+
+void SimApp::setup() {
+  std::stable_sort(this->components_.begin(), this->components_.end(),
+                   [](esphome::Component *a, esphome::Component *b) {
+                     return a->get_setup_priority() > b->get_setup_priority();
+                   });
+  for (auto *component : this->components_)
+    component->call_setup();
+}
+
+void SimApp::loop_once() {
+  // Idle until the next iteration (time spent on the bus counts against it)
+  if (now_us_ < this->next_loop_us_)
+    now_us_ = this->next_loop_us_;
+  this->next_loop_us_ = now_us_ + (uint64_t)this->loop_interval_ms_ * 1000;
+
+  scheduler_run();
+  for (auto *component : this->components_) {
+    if (component->is_failed())
+      continue;
+    uint64_t start = host_ns();
+    component->loop();
+    esphome::SimProfile &profile = component->sim_profile();
+    profile.loop_calls++;
+    profile.loop_ns += host_ns() - start;
+  }
+}
+
+void SimApp::run_for(uint32_t duration_ms) {
+  uint64_t end = now_us_ + (uint64_t)duration_ms * 1000;
+  while (now_us_ < end)
+    this->loop_once();
+}
+
+bool SimApp::run_until(const std::function<bool()> &done,
+                       uint32_t timeout_ms) {
+  uint64_t end = now_us_ + (uint64_t)timeout_ms * 1000;
+  while (!done()) {
+    if (now_us_ >= end)
+      return false;
+    this->loop_once();
+  }
+  return true;
+}
+
+void SimApp::shutdown() {
+  for (auto *component : this->components_)
+    component->on_shutdown();
+}
+
+} // namespace sen6x_sim
+
+// ========== ESPHOME SHIM IMPLEMENTATIONS ==========
+
+namespace esphome {
+
+ESPPreferences *global_preferences = nullptr; // NOLINT
+Application App;                              // NOLINT
+
+uint32_t millis() { return (uint32_t)(sen6x_sim::clock_us() / 1000); }
+uint32_t micros() { return (uint32_t)sen6x_sim::clock_us(); }
+void delay(uint32_t ms) { sen6x_sim::advance_clock_us((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { sen6x_sim::advance_clock_us(us); }
+
+uint32_t fnv1_hash(const std::string &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= (uint8_t)c;
+  }
+  return hash;
+}
+
+std::string base64_encode(const uint8_t *buf, size_t buf_len) {
+  static const char *const ALPHABET =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  out.reserve((buf_len + 2) / 3 * 4);
+  for (size_t i = 0; i < buf_len; i += 3) {
+    uint32_t chunk = (uint32_t)buf[i] << 16;
+    if (i + 1 < buf_len)
+      chunk |= (uint32_t)buf[i + 1] << 8;
+    if (i + 2 < buf_len)
+      chunk |= buf[i + 2];
+    out += ALPHABET[(chunk >> 18) & 0x3F];
+    out += ALPHABET[(chunk >> 12) & 0x3F];
+    out += i + 1 < buf_len ? ALPHABET[(chunk >> 6) & 0x3F] : '=';
+    out += i + 2 < buf_len ? ALPHABET[chunk & 0x3F] : '=';
+  }
+  return out;
+}
+
+void esp_log_printf_(int level, const char *tag, int line, const char *format,
+                     ...) {
+  if (level > sen6x_sim::log_level_)
+    return;
+  static const char *const LEVELS = "?EWICDVV";
+  va_list args;
+  va_start(args, format);
+  if (sen6x_sim::log_sink_) {
+    char message[512];
+    std::vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    sen6x_sim::log_sink_(level, tag, message);
+    return;
+  }
+  std::fprintf(stderr, "[%10.3f][%c][%s:%d]: ",
+               sen6x_sim::clock_us() / 1000000.0, LEVELS[level & 7], tag,
+               line);
+  std::vfprintf(stderr, format, args);
+  va_end(args);
+  std::fputc('\n', stderr);
+}
+
+void Component::set_timeout(const std::string &name, uint32_t timeout,
+                            std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, name, false, timeout, std::move(f),
+                           timeout);
+}
+void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, "", false, timeout, std::move(f),
+                           timeout);
+}
+bool Component::cancel_timeout(const std::string &name) {
+  return sen6x_sim::scheduler_cancel(this, name, false);
+}
+void Component::set_interval(const std::string &name, uint32_t interval,
+                             std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, name, true, interval, std::move(f),
+                           interval);
+}
+void Component::set_interval(uint32_t interval, std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, "", true, interval, std::move(f),
+                           interval);
+}
+bool Component::cancel_interval(const std::string &name) {
+  return sen6x_sim::scheduler_cancel(this, name, true);
+}
+void Component::defer(std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, "", false, 0, std::move(f), 0);
+}
+void Component::defer(const std::string &name, std::function<void()> &&f) {
+  sen6x_sim::scheduler_add(this, name, false, 0, std::move(f), 0);
+}
+
+void PollingComponent::call_setup() {
+  this->setup();
+  this->start_poller();
+}
+
+// The first update runs right after setup (ESPHome staggers it by a random
+// part of the interval; the simulation keeps runs reproducible)
+void PollingComponent::start_poller() {
+  sen6x_sim::scheduler_add(
+      this, "update", true, this->get_update_interval(),
+      [this]() {
+        uint64_t start = sen6x_sim::host_ns();
+        this->update();
+        uint64_t elapsed = sen6x_sim::host_ns() - start;
+        SimProfile &profile = this->sim_profile();
+        profile.update_calls++;
+        profile.update_ns += elapsed;
+        profile.update_max_ns = std::max(profile.update_max_ns, elapsed);
+      },
+      0);
+}
+
+void PollingComponent::stop_poller() { this->cancel_interval("update"); }
+
+} // namespace esphome
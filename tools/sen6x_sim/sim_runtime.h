@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// SEN6x host simulation - runtime
+// Simulated clock, scheduler, main loop and preference store behind the
+// ESPHome shims in esphome/. Nothing here sleeps: time only advances when the
+// loop idles, delay() is called or the simulated bus transfers bytes.
+
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace sen6x_sim {
+
+// ========== SIMULATED CLOCK ==========
+uint64_t clock_us();
+void advance_clock_us(uint64_t us);
+void reset_clock();
+
+// Deterministic xorshift32 PRNG (same sequence for the same seed)
+class SimRandom {
+public:
+  explicit SimRandom(uint32_t seed = 1) : state_(seed != 0 ? seed : 1) {}
+  uint32_t next() {
+    this->state_ ^= this->state_ << 13;
+    this->state_ ^= this->state_ >> 17;
+    this->state_ ^= this->state_ << 5;
+    return this->state_;
+  }
+  // Uniform in [0, 1)
+  float uniform() { return (this->next() >> 8) * (1.0f / 16777216.0f); }
+  bool chance(float probability) {
+    return probability > 0.0f && this->uniform() < probability;
+  }
+
+protected:
+  uint32_t state_;
+};
+
+// Log lines below this ESPHOME_LOG_LEVEL_* are dropped (default WARN)
+void set_log_level(int level);
+// Receives formatted messages instead of stderr while set (empty = stderr)
+using LogSink =
+    std::function<void(int level, const char *tag, const char *message)>;
+void set_log_sink(LogSink sink);
+
+// ========== PREFERENCES ==========
+// In-memory flash. A record survives SimApp instances (simulated reboots)
+// until clear() is called.
+class SimPreferences : public esphome::ESPPreferences {
+public:
+  esphome::ESPPreferenceObject make_preference(size_t length, uint32_t type,
+                                               bool in_flash) override;
+  bool sync() override;
+
+  void clear();
+  uint32_t get_save_count() const { return this->save_count_; }
+  uint32_t get_sync_count() const { return this->sync_count_; }
+
+protected:
+  class Slot : public esphome::ESPPreferenceBackend {
+  public:
+    Slot(SimPreferences *parent, uint32_t type) : parent_(parent), type_(type) {}
+    bool save(const uint8_t *data, size_t len) override;
+    bool load(uint8_t *data, size_t len) override;
+
+  protected:
+    SimPreferences *parent_;
+    uint32_t type_;
+  };
+
+  std::map<uint32_t, std::vector<uint8_t>> records_;
+  std::vector<std::unique_ptr<Slot>> slots_;
+  uint32_t save_count_{0};
+  uint32_t sync_count_{0};
+};
+
+SimPreferences &preferences();
+
+// ========== MAIN LOOP ==========
+static const uint32_t SIM_DEFAULT_LOOP_INTERVAL_MS =
+    16; // ESPHome default loop_interval
+
+class SimApp {
+public:
+  SimApp();
+  ~SimApp();
+
+  void register_component(esphome::Component *component);
+  void set_loop_interval(uint32_t interval_ms) {
+    this->loop_interval_ms_ = interval_ms;
+  }
+
+  // call_setup() of every component in setup priority order
+  void setup();
+  // One main loop iteration: due timers, then loop() of every component.
+  // The clock then idles until the next iteration is due.
+  void loop_once();
+  void run_for(uint32_t duration_ms);
+  // Runs until 'done' returns true; false on timeout
+  bool run_until(const std::function<bool()> &done, uint32_t timeout_ms);
+  void shutdown();
+
+protected:
+  std::vector<esphome::Component *> components_;
+  uint32_t loop_interval_ms_{SIM_DEFAULT_LOOP_INTERVAL_MS};
+  uint64_t next_loop_us_{0};
+};
+
+} // namespace sen6x_sim